@@ -0,0 +1,175 @@
+#!/bin/sh
+# Run each benchmark program in a directory several times and write the median
+# and minimum wall time and a checksum of the output of each program as JSON.
+# Compare the results with a baseline file when one is given and exit with a
+# failure status if any program got slower or changed its output.
+#
+# Usage: bench.sh <brainiac> <bench dir> <runs> <output> [baseline] [threshold]
+set -u
+
+EXEC=$1
+BENCH_DIR=$2
+RUNS=$3
+OUTPUT=$4
+BASELINE=${5:-}
+THRESHOLD=${6:-10}
+TIMES=$OUTPUT.times
+
+# Programs are always compiled from a fresh cache so that results do not depend
+# on bytecode left behind by other builds.
+BRAINIAC_CACHE_DIR=$OUTPUT.cache
+export BRAINIAC_CACHE_DIR
+rm -rf -- "$BRAINIAC_CACHE_DIR"
+
+# Run a command and append its wall time in microseconds to the times file.
+# Only GNU date can print nanoseconds, so other systems time the command with
+# Perl's high-resolution clock instead.
+if date +%N | grep -q '^[0-9][0-9]*$'; then
+	timeRun() {
+		start=$(date +%s%N)
+		"$@" || return 1
+		end=$(date +%s%N)
+		echo $(((end - start) / 1000)) >> "$TIMES"
+	}
+elif command -v perl > /dev/null 2>&1; then
+	timeRun() {
+		perl -MTime::HiRes=time -e '
+			$times = shift;
+			$start = time;
+			system(@ARGV) == 0 or exit 1;
+			$time = time - $start;
+			open(TIMES, ">>", $times) or exit 1;
+			printf TIMES "%.0f\n", $time * 1000000;
+		' "$TIMES" "$@"
+	}
+else
+	echo "No high-resolution clock found. GNU date or Perl is required."
+	exit 1
+fi
+
+{
+	echo "{"
+	echo "  \"binary\": \"$EXEC\","
+	echo "  \"runs\": $RUNS,"
+	echo "  \"programs\": ["
+} > "$OUTPUT"
+
+separator=""
+
+for program in "$BENCH_DIR"/*.bf; do
+	name=$(basename "$program" .bf)
+	input=$BENCH_DIR/$name.in
+
+	if [ ! -f "$input" ]; then
+		input=/dev/null
+	fi
+
+	echo "Benchmarking '$name'..."
+	: > "$TIMES"
+	checksum=""
+	run=0
+
+	# The program is compiled to the cache before it is timed so that the
+	# measured times do not include compiling it.
+	"$EXEC" --compile-only "$program" || exit 1
+
+	while [ "$run" -lt "$RUNS" ]; do
+		timeRun "$EXEC" "$program" < "$input" > "$OUTPUT.out" || exit 1
+		sum=$(cksum < "$OUTPUT.out" | awk '{ print $1 "-" $2 }')
+
+		if [ -n "$checksum" ] && [ "$sum" != "$checksum" ]; then
+			echo "Output of '$name' differs between runs."
+			exit 1
+		fi
+
+		checksum=$sum
+		run=$((run + 1))
+	done
+
+	sort -n "$TIMES" | awk -v name="$name" -v checksum="$checksum" -v separator="$separator" '
+		{ times[NR] = $1 }
+		END {
+			if (NR % 2 == 1) {
+				median = times[(NR + 1) / 2];
+			} else {
+				median = (times[NR / 2] + times[NR / 2 + 1]) / 2;
+			}
+
+			printf "%s    {\"name\": \"%s\", \"median_ms\": %.3f, \"min_ms\": %.3f, \"checksum\": \"%s\"}", separator, name, median / 1000, times[1] / 1000, checksum;
+		}' >> "$OUTPUT"
+	separator=",
+"
+done
+
+{
+	echo
+	echo "  ]"
+	echo "}"
+} >> "$OUTPUT"
+
+rm -rf -- "$TIMES" "$OUTPUT.out" "$BRAINIAC_CACHE_DIR"
+echo "Results written to '$OUTPUT'."
+
+if [ -z "$BASELINE" ]; then
+	exit 0
+fi
+
+# Programs are compared by name, one program per line in both files. Programs
+# that are missing from the baseline are reported but not flagged.
+awk -v threshold="$THRESHOLD" '
+	function field(line, key,    start, rest) {
+		start = index(line, "\"" key "\": ");
+
+		if (start == 0) {
+			return "";
+		}
+
+		rest = substr(line, start + length(key) + 4);
+		sub(/^"/, "", rest);
+		sub(/["},].*$/, "", rest);
+		return rest;
+	}
+
+	FNR == NR {
+		if ($0 ~ /"name": /) {
+			name = field($0, "name");
+			baseMedian[name] = field($0, "median_ms");
+			baseChecksum[name] = field($0, "checksum");
+		}
+
+		next;
+	}
+
+	/"name": / {
+		name = field($0, "name");
+		median = field($0, "median_ms");
+
+		if (!(name in baseMedian)) {
+			printf "%-12s %10.3f ms    (not in baseline)\n", name, median;
+			next;
+		}
+
+		change = baseMedian[name] > 0 ? (median - baseMedian[name]) * 100 / baseMedian[name] : 0;
+		status = "ok";
+
+		if (field($0, "checksum") != baseChecksum[name]) {
+			status = "OUTPUT CHANGED";
+			flagged++;
+		} else if (change > threshold) {
+			status = "SLOWER";
+			flagged++;
+		} else if (change < -threshold) {
+			status = "faster";
+		}
+
+		printf "%-12s %10.3f ms %10.3f ms %+8.1f%%    %s\n", name, baseMedian[name], median, change, status;
+	}
+
+	END {
+		if (flagged > 0) {
+			printf "%d program(s) flagged against the baseline (threshold %s%%).\n", flagged, threshold;
+			exit 1;
+		}
+
+		printf "No programs flagged against the baseline (threshold %s%%).\n", threshold;
+	}' "$BASELINE" "$OUTPUT"
@@ -0,0 +1,6 @@
+Generated code
+Runs 600 blocks of nested counting loops that step a linear congruential
+generator seeded with one byte of input
+Every fourth block prints the low byte of the generator in decimal
+
+,>>>+++++++++++[->---------------------------------------------------------------------[-<<<<[->+++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->----------------------------------------------------------------------------------------------[-<<<<[->+++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->----------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------<]>[-<+>]<------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->-----------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<----------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------[-<<<<[->+++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->---------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->-------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->--------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->-------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->--------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->-----------------------------------------------------------------------------------[-<<<<[->-----------------------------------------<]>[-<+>]<------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->---------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->----------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->---------------[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->---------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->--------------------------[-<<<<[->---------------------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->---------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->-------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<----------[->>+<+<]>[-<+>]>>>]<]++++++[->----------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------------------------------[-<<<<[->+++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->-------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->-------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------<]>[-<+>]<----------------[->>+<+<]>[-<+>]>>>]<]++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->----------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->---------------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->----------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<---------------------[->>+<+<]>[-<+>]>>>]<]++++[->--------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------------------------------------------------------------[-<<<<[->+++++++++<]>[-<+>]<--------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------[-<<<<[->+++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------------------------------[-<<<<[->-------------<]>[-<+>]<----------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->-----------------------------------------------------------------------------------------[-<<<<[->---------------------<]>[-<+>]<--------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->---------------[-<<<<[->+++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->-------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->---------------------------------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<-----------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->----------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->----------------------[-<<<<[->+++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->----------[-<<<<[->---------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<-----------------[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->---------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------<]>[-<+>]<-----[->>+<+<]>[-<+>]>>>]<]++++++[->---------------[-<<<<[->-<]>[-<+>]<------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->--------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->-------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->----------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->--------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->---------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++<]>[-<+>]<++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->----------[-<<<<[->-------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------[-<<<<[->+++++++++++<]>[-<+>]<-----------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------[-<<<<[->+++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->-------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------------------[-<<<<[->+++++++++++++++++++++<]>[-<+>]<------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->---------------------------------[-<<<<[->-------------------<]>[-<+>]<+++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->--------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->----------------------------------------------------------------------------------------------------------[-<<<<[->-------<]>[-<+>]<------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->-------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------<]>[-<+>]<--------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->-----------------------------------------------------[-<<<<[->+++++++<]>[-<+>]<+++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->----------------------------------------------------------------------------------------------------[-<<<<[->---------------------<]>[-<+>]<-----------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------[-<<<<[->---------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->---------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------------------------------------<]>[-<+>]<-----------------------[->>+<+<]>[-<+>]>>>]<]+++++[->----------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<-----------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->-------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->------------------[-<<<<[->---<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->---------------------------[-<<<<[->+++++++<]>[-<+>]<------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<-------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->----------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->----------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->-------------------------[-<<<<[->---------------------<]>[-<+>]<+++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------[-<<<<[->-<]>[-<+>]<--------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------<]>[-<+>]<----------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->----------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->-------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->---------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->--------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->-------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->-------------[-<<<<[->-<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------[-<<<<[->-----------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->----------------------------------------------[-<<<<[->---------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++<]>[-<+>]<---------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------<]>[-<+>]<---------------------[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------[-<<<<[->-----------------------------------------------<]>[-<+>]<+++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->---------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------------------------------------------------[-<<<<[->-<]>[-<+>]<-----------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->----------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------------------<]>[-<+>]<--------------------[->>+<+<]>[-<+>]>>>]<]++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->------------------------------------------------------------------------------------------------[-<<<<[->+++++<]>[-<+>]<-------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->-------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->--------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------<]>[-<+>]<-----------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->------------------------------------------------------------------[-<<<<[->+++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->--------------------------------------------------------------------[-<<<<[->-----------<]>[-<+>]<----------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->---------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++[->>+<+<]>[-<+>]>>>]<]+++++++[->----------------------------------------[-<<<<[->-------------------------------------<]>[-<+>]<-----------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->---------------------------------------------------------[-<<<<[->-----------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->----------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->----------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->-----------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------<]>[-<+>]<+++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------------------------------------[-<<<<[->-------------------<]>[-<+>]<-----------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------------------------------[-<<<<[->-----<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->--------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->----------------------------------[-<<<<[->---------------------------------<]>[-<+>]<---[->>+<+<]>[-<+>]>>>]<]+++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->---------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->-------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->------------------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->--------[-<<<<[->---------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->---------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->-----------------------------------[-<<<<[->+++++++++<]>[-<+>]<---[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------------------------------------------------------------------------[-<<<<[->---------------------<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->---------------------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->-------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------[-<<<<[->-----------------------<]>[-<+>]<---------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------<]>[-<+>]<------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->-------------------------[-<<<<[->---------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->---------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<--------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->--------------------------------------------------------------------------------------------------------------------------------[-<<<<[->-----<]>[-<+>]<++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++<]>[-<+>]<-----------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->-------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------<]>[-<+>]<------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->--------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->----------------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->---------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------<]>[-<+>]<----------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++<]>[-<+>]<--------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->------------------------[-<<<<[->-----------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------[-<<<<[->+++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->---------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<-----------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->--------------------------------------------------------------------------------------------[-<<<<[->-----------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->-------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------<]>[-<+>]<------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->-------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------<]>[-<+>]<------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->---------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------<]>[-<+>]<---------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->----------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------------------------[-<<<<[->-------------------------------------<]>[-<+>]<++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->--------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------------------------------------------------------------------[-<<<<[->-----------------------------<]>[-<+>]<------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->---------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------<]>[-<+>]<------------[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------[-<<<<[->-------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++<]>[-<+>]<------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++<]>[-<+>]<--------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->----------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->--------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->--------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------<]>[-<+>]<--[->>+<+<]>[-<+>]>>>]<]+++++++[->-------------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------------------[-<<<<[->+++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->-----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------[-<<<<[->-------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------------------------------------------------------[-<<<<[->-----<]>[-<+>]<------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------[-<<<<[->---------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->------------------------------------[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->---------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->--------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->---------------------------------------------------------------[-<<<<[->-------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->---------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->---------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------<]>[-<+>]<-----------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------------------------------------------------------------------------------------[-<<<<[->-------<]>[-<+>]<+++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->--------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++<]>[-<+>]<------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->----------------[-<<<<[->+++++++++++++++++++<]>[-<+>]<----------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------------[-<<<<[->-------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->----------------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------<]>[-<+>]<-------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++<]>[-<+>]<------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->---------------------------------------------------------------[-<<<<[->+++<]>[-<+>]<----------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------------------------------------------------------[-<<<<[->-<]>[-<+>]<+++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-------------[-<<<<[->-------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->-------------------------------------------------------------------------------[-<<<<[->+++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->---------------------------------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->----------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------[->>+<+<]>[-<+>]>>>]<]+++++[->---------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------------------<]>[-<+>]<-------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->----------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------------------------[-<<<<[->+++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->----------------------[-<<<<[->+++++++<]>[-<+>]<-----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->--------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->----------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->---------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->----------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->---------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->--------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++<]>[-<+>]<-------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->--------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------------------------[-<<<<[->---------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------[-<<<<[->---------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------[-<<<<[->-------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->-------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->--------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->--------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->--------------------------------------------------------------------------[-<<<<[->+++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->----------------------------------------------------------------------[-<<<<[->+++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<----[->>+<+<]>[-<+>]>>>]<]++++++[->-----------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->--------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------------------------------------------------------------------------------------------------[-<<<<[->-----<]>[-<+>]<---[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------------------------------[-<<<<[->-----<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->------------------------------------------------[-<<<<[->+++<]>[-<+>]<++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->--------------------------------------------------------[-<<<<[->+++++++++++<]>[-<+>]<+++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->---------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------<]>[-<+>]<-------------------[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------<]>[-<+>]<-----[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------<]>[-<+>]<--------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->---------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->-----------------------------------------[-<<<<[->-----------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->---------[-<<<<[->---------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->----------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->----------------------[-<<<<[->+++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->-------------------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->---------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------[-<<<<[->-----------------------<]>[-<+>]<-----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->-------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->-----------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------------------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------<]>[-<+>]<---------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++[->>+<+<]>[-<+>]>>>]<]++++++++[->-----------------------------------------------[-<<<<[->-------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------<]>[-<+>]<-----------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->--------------------------[-<<<<[->---------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-------------------------------------------------------------------------------------------[-<<<<[->+++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->-----------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->--------------------------------------------[-<<<<[->---------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->----------------------------------------------------[-<<<<[->+++++<]>[-<+>]<++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->---------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->---------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------------------[-<<<<[->-----------------------------------------------------------------------------------------------<]>[-<+>]<------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------<]>[-<+>]<------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->---------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->----------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->-------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-------------------------------------------------------------------------------------------------[-<<<<[->-------------<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->-----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->---------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->---------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------[-<<<<[->---------------------------------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->-------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->--------------------------------------------------------------------------------[-<<<<[->-----------<]>[-<+>]<--------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->--------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------[-<<<<[->---------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->-----------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->---------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->-----------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->-----------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------------[-<<<<[->+++++++++++++++<]>[-<+>]<------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->-----------------------[-<<<<[->---------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->----------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->---------------------------------------------------------------[-<<<<[->+++++<]>[-<+>]<++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->----------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------<]>[-<+>]<------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->-----------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------------------------------------[-<<<<[->---------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->---------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------[-<<<<[->-----------------------------------------------------------------------<]>[-<+>]<-----------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------[->>+<+<]>[-<+>]>>>]<]++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++<]>[-<+>]<--------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->------------------------------------------------------------------------------------------------------------[-<<<<[->-<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->---------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->-------------------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------<]>[-<+>]<---------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->-----------------------------[-<<<<[->-----------------------------------------------<]>[-<+>]<------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->---------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->------------[-<<<<[->-------------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->----------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------------------------------[-<<<<[->-----------------------------------<]>[-<+>]<--------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-----------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->-------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++<]>[-<+>]<--------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->-------------------------------------[-<<<<[->-----------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-------------------------------------------------------------------------------------------------------[-<<<<[->-----------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->---------------------------------------------------------------------------[-<<<<[->+++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------<]>[-<+>]<---------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->--------------------------------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------[-<<<<[->+++++++++++<]>[-<+>]<------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->-------------[-<<<<[->---------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->--------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->----------[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->----------------------------[-<<<<[->-----------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-----------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->----------------------------------------[-<<<<[->---------------------<]>[-<+>]<--------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-------------------[-<<<<[->---------------<]>[-<+>]<-------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->----------------------------------[-<<<<[->-<]>[-<+>]<-[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->--------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->----------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->---------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------<]>[-<+>]<--[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->------------------------------------------------------------------------------------------------[-<<<<[->+++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------<]>[-<+>]<++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->----------------------------------[-<<<<[->-----------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------[->>+<+<]>[-<+>]>>>]<]++++++[->-----------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->----------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->-------------------------------------------------------------------------------------[-<<<<[->-----------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->-------------------------------------------------------------------------------------------------------------------------[-<<<<[->---<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->----------------------------------------[-<<<<[->---<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->--------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------<]>[-<+>]<-------[->>+<+<]>[-<+>]>>>]<]+++++++[->---------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------------<]>[-<+>]<-------[->>+<+<]>[-<+>]>>>]<]++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->----------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------<]>[-<+>]<------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------[-<<<<[->---------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->----------------------------------------------------------------------------------------[-<<<<[->+++++++<]>[-<+>]<++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------------<]>[-<+>]<------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->-------------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------<]>[-<+>]<++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->--------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------<]>[-<+>]<-----------------[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->--------------------------------------------------[-<<<<[->+++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->-----------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++[->------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<---------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->--------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->------------------------------------------[-<<<<[->---------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------------------------------------<]>[-<+>]<++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++[->-------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------<]>[-<+>]<--[->>+<+<]>[-<+>]>>>]<]+++++++++++[->----------------------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-----------------------------------------[-<<<<[->+++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++[->>+<+<]>[-<+>]>>>]<]++++++[->-----------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->------------------------------------------------------------------------[-<<<<[->+++++++++++++++++<]>[-<+>]<-----------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->---------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------[->>+<+<]>[-<+>]>>>]<]+++++[->--------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->--------[-<<<<[->---------------------------------------------------------------------------------------------<]>[-<+>]<-------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->-------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->--------------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->---------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++[->----------------------------[-<<<<[->-------------<]>[-<+>]<++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-------------------------[-<<<<[->+++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------------<]>[-<+>]<--------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->---------------------------------------------[-<<<<[->-----------------------------------------------------------------------------------<]>[-<+>]<----------------[->>+<+<]>[-<+>]>>>]<]++++[->--------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->-----------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->----------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<--------------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->---------------------------------------------------------------------------------------[-<<<<[->---------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---------------------------------------------<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++[->----------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++<]>[-<+>]<-----------------[->>+<+<]>[-<+>]>>>]<]++++[->-----------------------------------[-<<<<[->-------------------------------------------<]>[-<+>]<++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->---------------[-<<<<[->+++++<]>[-<+>]<-------------------------------------------------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++[->------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->--------------------------------------[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]++++++++++[->------------------------------------------------------------------------------------------------------------------------[-<<<<[->+++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->-------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------<]>[-<+>]<----------[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------<]>[-<+>]<---------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->---<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>+++++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-----------------<]>[-<+>]<+++++++++++++++++++++++++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++[->------------------------------------------------------------------------------------------------------[-<<<<[->---------------------------------------------------------------------------------------------------------------------<]>[-<+>]<++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++[->-------------------------------------------------------------------------------------------[-<<<<[->-------------------------------------------------------------------------------------------------------------<]>[-<+>]<+++++++++++++++++++++++++++[->>+<+<]>[-<+>]>>>]<]+++++++++[->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<]>[-<+>]<++++++++++++++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]>>++++++[->----------[-<<<<[->+++++++++++++++++<]>[-<+>]<----------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->-------------------------------------------------------------------------------------------------------------------------------<]>[-<+>]<--------------------------------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->-----------------------------------------------------------------------------------------------------[-<<<<[->-----------------------------------------------------<]>[-<+>]<----------------------------------------------------------------------------------------------[->>+<+<]>[-<+>]>>>]<]+++++++++++[->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<<<[->+++++++++++++++++++++++++++++++<]>[-<+>]<+++[->>+<+<]>[-<+>]>>>]<]<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[->>>>+<<<<]>>>>>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<[-]++++++++++.[-]
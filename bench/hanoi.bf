@@ -0,0 +1,6 @@
+Towers of Hanoi
+Reads a number of disks in decimal followed by a line feed and prints each
+move as a source peg digit and a destination peg digit on its own line
+The recursion is kept in a stack of frames in memory
+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>,----------[--------------------------------------<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>++++++++++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>],----------]<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>[-]+>>[-]+>[-]+++<<<<[>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[>>>>[-]<<++++++<<<<<<<<<<<<<<[->>>>>+>>>>>+>>>>-<<<<<<<<<<<<<<]>[->>>>>+>>>>>>>>>+<-<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<+>>>>>>>>>>>+>>>]<<<<<<<<<<<<<<<-[->>>>>>>>>>+>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<+>++>>>>+>+>>>>[-]]>>>>[<<<<<<<<<<<<<<<<<<-[>>++++++++++++++++++++++++++++++++++++++++++++++++.>++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>>>>>++++++++++.[-]<<<<<<<<<<<<<<<[-]]<[-]>>>[-]>[-]>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<[>>>>>]<<<<<]
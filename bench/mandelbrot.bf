@@ -0,0 +1,7 @@
+Mandelbrot set renderer
+Draws an 80 by 37 ASCII rendering of the Mandelbrot set with fixed point
+arithmetic in memory cells
+Points are printed as letters by escape iteration count and points inside
+the set are printed as spaces
+
+>>>++++++++++++++++++++++++++++++++++++>>>>>>>>>>>>>>>>>>>+++++++++++++++++++++++++++++++++++++[<<<<<<<<<<<<<<<<<<<<<<[-]>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>>>>>>>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[<<<<<<<<<<<<<<<<<<<<<[->>>>+>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>+>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<[->>>>+>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>>>>>+>>>>>>>>>>>>>++++++++++++++++++++++++<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<[>+>>>>>>>>>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>+>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<[->>>>>>+>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++<<<<<<<<<<<<<<<[->[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>>->+<[>-]>[<++++++++++++++++++++++++++++++++<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+>+<[>-]>[<<<<<<<<<<<<[-]+>>>>>>>>>>>->->]<<<<<>->]<<<<<<<<<<<<<<<]<<]>[-]>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<[->>>>>+>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->>>>+>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++<<<<<<<<<<<<<<<[->[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>>->+<[>-]>[<++++++++++++++++++++++++++++++++<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>+>+<[>-]>[<<<<<<<<<<<<[-]+>>>>>>>>>>>->->]<<<<<>->]<<<<<<<<<<<<<<<]<<]>[-]>>>>>>>>>>>>>>[-]>>>[-]<<<<<<<<<<<<<+>>[[-]<<[-]>>>[-]<<<<<<<<<<<[-]>[-]>>>>>>>>>]<<[[-]<<<<<<<<<<<<[->>>>>>>+>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<[->>>>>>+>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>[-]++++++++++++++++<<<<<<<<<<<<<<<[->[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>>->+<[>-]>[<++++++++++++++++<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>->]<<<<<<<<<<<<<<<]<<]>[-]>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[[-]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[[-]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>->+<[>-]>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>->]<<+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-<<<<+>>>>]>[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>[-]>]<[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<]<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>>>>>>>>[->+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>[-]>]<[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>[-]]<]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>>>>>>>>>[->+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>[-]>]<[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>[-]]<]<<<<<<[[-]<<<<<<<[-<<<+>>>]>>>>>>>]<<<<<<<[-<<<<+>>>>]<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>>>>>>[->+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>[-]>]<[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>[-]]<]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>>>>>>>>>[->+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>[-]>]<[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>[-]]<]>>>>>>>>>->+<[>-]>[<<<<<<<<<<<<<<[-]>[-]++++++++++++++++++++++++++++++++>>>>>>>>>>>>>->]<<<<<<<<<<<<<<<<<<]>>>]>.<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<[-]>>>+[->+<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>[-]>]<[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>[-]]<]<<-]<<<<<<<++++++++++.[-]>>>>>>>>>++[->+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>[-]>]<[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>[-]]<]<-]
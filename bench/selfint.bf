@@ -0,0 +1,6 @@
+Brainfuck interpreter
+Reads a program terminated by an exclamation mark and runs it on the rest of
+its input
+Bracket matching is done by scanning the stored program at run time
+
+>>>>>>>>>>>>>>>>>+[<<<<<,>+<[>-]>[<>>>>>>>+<<<<<<<>->]<<--------------------------------->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<>>>>>>>[[-]<<[-]>>]<<<<<<<---------->+<[>-]>[<<<+>>>->]<<->+<[>-]>[<<<++++++>>>->]<<->+<[>-]>[<<<++>>>->]<<->+<[>-]>[<<<+++++>>>->]<<-------------->+<[>-]>[<<<++++>>>->]<<-->+<[>-]>[<<<+++>>>->]<<----------------------------->+<[>-]>[<<<+++++++>>>->]<<-->+<[>-]>[<<<++++++++>>>->]<<[-]<<[->>>>>>>>+<<<<<+<<<]>>>[-<<<+>>>]>>>>>[[-]<<<<<<<+>>>>>>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>>]<]<<<<<<+[<<<<<<<<<<]>>>>>>>>>>-<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[[-]<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<<<<<>>>>>>>>>>[>>>>>>>>>>]<+><<<<<<<<<<[<<<<<<<<<<]>>>>>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<-->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<<<<<>>>>>>>>>>[>>>>>>>>>>]<-><<<<<<<<<<[<<<<<<<<<<]>>>>>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<--->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<<<<<>>>>>>>>>>[>>>>>>>>>>]+<<<<<<<<<<[<<<<<<<<<<]>>>>>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<---->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<<<<<>>>>>>>>>>[>>>>>>>>>>]<<<<<<<<<<-<<<<<<<<<<[<<<<<<<<<<]>>>>>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<----->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<<<<<>>>>>>>>>>[>>>>>>>>>>]<.><<<<<<<<<<[<<<<<<<<<<]>>>>>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<------>+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<<<<<>>>>>>>>>>[>>>>>>>>>>]<,><<<<<<<<<<[<<<<<<<<<<]>>>>>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<-------->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<+[<<<<+>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<-<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<-------->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<+>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<------->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<->>>>]<<<<]>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<------->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<<<<<>>>>>>>>>>[>>>>>>>>>>]<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<[[-]>>>>[-]+<<<<]<<<<<<<<<<<[<<<<<<<<<<]>>>>>+<<<<<>>>>>>>>>>[>>>>>>>>>>]>>>>>[[-]<<<<<<<<<<<<<<<[<<<<<<<<<<]>>>>>[-]<<<<<>>>>>>>>>>[>>>>>>>>>>]>>>>>]<<<<<<<<<<<<<<<[<<<<<<<<<<]>>>>>[[-]<+[<<<<+>>>>[->>>>>>>>>>+<<<<<<<<<<]>>>>>>-<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<------->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<+>>>>]<<<<<<<<<[->>+>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<-------->+<[>-]>[<>>>>>>>+<<<<<<<>->]<<[-]>>>>>>>[[-]<<<<->>>>]<<<<]>]>>>]<<<<<<<<+>>>>>>>>>>-<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<]
@@ -0,0 +1,53 @@
+#!/bin/sh
+# Start a server on a temporary socket, run a load test of each benchmark
+# program in a directory against it, and stop the server. The load test prints
+# the latency percentiles and throughput of each program's requests.
+#
+# Usage: serve.sh <brainiac> <bench dir> <requests> <connections>
+set -u
+
+EXEC=$1
+BENCH_DIR=$2
+REQUESTS=$3
+CONNECTIONS=$4
+SOCKET=${TMPDIR:-/tmp}/brainiac-serve.$$.sock
+
+# Programs are always compiled from a fresh cache so that requests by hash are
+# not answered with bytecode left behind by other builds.
+BRAINIAC_CACHE_DIR=${TMPDIR:-/tmp}/brainiac-serve.$$.cache
+export BRAINIAC_CACHE_DIR
+
+"$EXEC" --serve "$SOCKET" &
+server=$!
+
+# Stop the server and remove its files.
+stop() {
+	kill "$server" 2> /dev/null
+	wait "$server" 2> /dev/null
+	rm -rf -- "$SOCKET" "$BRAINIAC_CACHE_DIR"
+}
+
+trap stop EXIT
+waited=0
+
+while [ ! -S "$SOCKET" ]; do
+	if [ "$waited" -ge 50 ] || ! kill -0 "$server" 2> /dev/null; then
+		echo "Could not start a server on '$SOCKET'."
+		exit 1
+	fi
+
+	sleep 0.1
+	waited=$((waited + 1))
+done
+
+for program in "$BENCH_DIR"/*.bf; do
+	name=$(basename "$program" .bf)
+	input=$BENCH_DIR/$name.in
+
+	if [ ! -f "$input" ]; then
+		input=/dev/null
+	fi
+
+	echo "Load testing '$name'..."
+	"$EXEC" --connect="$SOCKET" --load="$REQUESTS" --threads="$CONNECTIONS" "$program" < "$input" || exit 1
+done
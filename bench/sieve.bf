@@ -0,0 +1,5 @@
+Sieve of Eratosthenes
+Prints each prime number below 26000 in decimal on its own line
+Only odd numbers are kept in the sieve
+
+>>++++++++++++++++++++++++++++++++++++++++++++++++++.[-]++++++++++.[-]>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[-<<+>>>[->>>>>+<<<<<]<[->>>>>+<<<<<]>>>>>]>]<<<<<<<<[<<<<<]>>>>>>+>>>>>>+++>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[>+<<<[>>>-<<<-]>>>[<<<->[->>>>>+>+>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<[-]>>>>>[>>->>>>>+<<<<<[>>>>>-]>>>>>[<<<<<<[-]+>>[-<+>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<>>>>>->>>>>]<<<<<<<<<<>[->>>>>+<<<<<]<[->>>>>+<<<<<]>>>]>>[-]>[-]<<<<<<<<[<<<<<]+>>>>[-]]<<<+>++>-[->>>>>+<<<<<]<[->>>>>+<<<<<]>>>>>>]<[-]<<<<<<<[<<<<<]>>>>>>>+<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>[[-]>[-]<]>[<<<<<<<<<<<[->>>>>>>>>+<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>[[-]<<<<[-]+>>>>]<<<<<[->>>>>+<<<+<<]>>[-<<+>>]>>>[[-]<<<<[-]+>>>>]<<<<[<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>[-]+>[-]]<<<<<<[->>>>>>>>>>+<<<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>[[-]<<<<[-]+>>>>]<<<<<[->>>>>+<<<+<<]>>[-<<+>>]>>>[[-]<<<<[-]+>>>>]<<<<[<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>>[-]+>[-]]<<<<<<<<<[->>>>>>>>>>>>>+<<<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>>>[[-]<<<<[-]+>>>>]<<<<<[->>>>>+<<<+<<]>>[-<<+>>]>>>[[-]<<<<[-]+>>>>]<<<<[<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>>>>>[-]+>[-]]<<<<<<<<<<[->>>>>>>>>>>>>>+<<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>>>[[-]<<<<[-]+>>>>]<<<<<[->>>>>+<<<+<<]>>[-<<+>>]>>>[[-]<<<<[-]+>>>>]<<<<[<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>>>>>>[-]+>[-]]<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>[[-]<<<<[-]+>>>>]<<<<<[->>>>>+<<<+<<]>>[-<<+>>]>>>[[-]<<<<[-]+>>>>]<<<<[-]+[<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>>>>>>>[-]+>[-]]<[-]++++++++++.[-]>>>>>>>[-]]<<<<<<<<<<<<<<<<<++----------->>>>>>>>>>+<<<<<<<<<<[>>>>>>>>>>-]>>>>>>>>>>[<<<<<<<<<<+>+---------->>>>>>>>>>+<<<<<<<<<<[>>>>>>>>>>-]>>>>>>>>>>[<<<<<<<<<<>+---------->>>>>>>>>>+<<<<<<<<<<[>>>>>>>>>>-]>>>>>>>>>>[<<<<<<<<<<>>>+---------->>>>>>>>>>+<<<<<<<<<<[>>>>>>>>>>-]>>>>>>>>>>[<<<<<<<<<<>+---------->>>>>>>>>>+<<<<<<<<<<[>>>>>>>>>>-]>>>>>>>>>>[<<<<<<<<<<---------->>>>>>>>>>->>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<++++++++++<---------->>>>>>>>>>->>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<++++++++++<<<---------->>>>>>>>>>->>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<++++++++++<---------->>>>>>>>>>->>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<++++++++++<----------->>>>>>>>>>->>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<+++++++++++>>>>>>[->>>>>+<<<<<]<[->>>>>+<<<<<]<<<[->>>>>+<<<<<]<[->>>>>+<<<<<]<[->>>>>+<<<<<]>>>]>>[-]>[-]>[-]>>>[-]>[-]
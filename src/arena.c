@@ -0,0 +1,105 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "arena.h"
+
+// The minimum size of an arena's blocks in bytes.
+#define ARENA_BLOCK_SIZE 65536
+
+// The alignment of allocations from an arena in bytes.
+#define ARENA_ALIGNMENT 16
+
+// A block of memory in an arena.
+typedef struct ArenaBlock {
+	// The previously allocated block, or NULL if this is the first block.
+	struct ArenaBlock *previous;
+} ArenaBlock;
+
+// A region of memory that allocations are made from and freed with at once.
+struct Arena {
+	// The most recently allocated block, or NULL if no blocks are allocated.
+	ArenaBlock *block;
+	
+	// The next free byte in the most recently allocated block.
+	uint8_t *next;
+	
+	// The end of the most recently allocated block.
+	uint8_t *end;
+	
+	// The jump buffer to jump to on allocation failures, or NULL to exit.
+	jmp_buf *recovery;
+};
+
+// The size of a block's header in bytes, rounded up to keep allocations
+// aligned.
+#define ARENA_HEADER_SIZE ((sizeof(ArenaBlock) + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT)
+
+// Allocate a new empty arena, or return NULL if it could not be allocated.
+Arena *newArena() {
+	Arena *arena = (Arena*)malloc(sizeof(Arena));
+	
+	if (arena == NULL) {
+		return NULL;
+	}
+	
+	arena->block = NULL;
+	arena->next = NULL;
+	arena->end = NULL;
+	arena->recovery = NULL;
+	return arena;
+}
+
+// Allocate memory from an arena. The memory is aligned for any type and is
+// freed with the arena. Allocation failures are handled with failArena.
+void *allocateArena(Arena *arena, size_t size) {
+	size = (size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+	
+	if (arena->block == NULL || (size_t)(arena->end - arena->next) < size) {
+		size_t blockSize = size > ARENA_BLOCK_SIZE - ARENA_HEADER_SIZE ? size + ARENA_HEADER_SIZE : ARENA_BLOCK_SIZE;
+		ArenaBlock *block = (ArenaBlock*)malloc(blockSize);
+		
+		if (block == NULL) {
+			failArena(arena);
+		}
+		
+		block->previous = arena->block;
+		arena->block = block;
+		arena->next = (uint8_t*)block + ARENA_HEADER_SIZE;
+		arena->end = (uint8_t*)block + blockSize;
+	}
+	
+	void *memory = arena->next;
+	arena->next += size;
+	return memory;
+}
+
+// Set the jump buffer that an arena's allocation failures jump to, or NULL to
+// exit on allocation failures, and return the previous jump buffer.
+jmp_buf *setArenaRecovery(Arena *arena, jmp_buf *recovery) {
+	jmp_buf *previous = arena->recovery;
+	arena->recovery = recovery;
+	return previous;
+}
+
+// Handle a failure to allocate memory for an arena or for data built with it by
+// jumping to the arena's jump buffer, or exiting if it has none.
+void failArena(Arena *arena) {
+	if (arena->recovery == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	longjmp(*arena->recovery, 1);
+}
+
+// Free an arena and all memory allocated from it.
+void freeArena(Arena *arena) {
+	ArenaBlock *block = arena->block;
+	
+	while (block != NULL) {
+		ArenaBlock *previous = block->previous;
+		free(block);
+		block = previous;
+	}
+	
+	free(arena);
+}
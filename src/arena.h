@@ -0,0 +1,28 @@
+#ifndef BRAINIAC_ARENA_H
+#define BRAINIAC_ARENA_H
+
+#include <setjmp.h>
+#include <stddef.h>
+
+// A region of memory that allocations are made from and freed with at once.
+typedef struct Arena Arena;
+
+// Allocate a new empty arena, or return NULL if it could not be allocated.
+Arena *newArena();
+
+// Allocate memory from an arena. The memory is aligned for any type and is
+// freed with the arena. Allocation failures are handled with failArena.
+void *allocateArena(Arena *arena, size_t size);
+
+// Set the jump buffer that an arena's allocation failures jump to, or NULL to
+// exit on allocation failures, and return the previous jump buffer.
+jmp_buf *setArenaRecovery(Arena *arena, jmp_buf *recovery);
+
+// Handle a failure to allocate memory for an arena or for data built with it by
+// jumping to the arena's jump buffer, or exiting if it has none.
+void failArena(Arena *arena);
+
+// Free an arena and all memory allocated from it.
+void freeArena(Arena *arena);
+
+#endif // BRAINIAC_ARENA_H
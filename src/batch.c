@@ -0,0 +1,573 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "batch.h"
+#include "compiler.h"
+#include "scheduler.h"
+#include "source.h"
+
+// A program run by jobs in a batch.
+typedef struct {
+	// The program's source path.
+	const char *path;
+	
+	// The program's bytecode.
+	Bytecode bytecode;
+	
+	// Whether the program's bytecode was compiled.
+	bool isCompiled;
+} BatchProgram;
+
+// The state of a batch job that is run in slices.
+typedef struct {
+	// The job's wrapping tape.
+	Tape tape;
+	
+	// The job's I/O.
+	IO io;
+	
+	// The job's memory pointer and program counter between slices.
+	VMState state;
+	
+	// The job's remaining loop iterations, or 0 if it has no limit.
+	uint64_t fuel;
+	
+	// The job's input file, or NULL if the job has no input.
+	FILE *input;
+	
+	// The job's output file, or NULL if the job's output is discarded.
+	FILE *output;
+} BatchRun;
+
+// A job in a batch that runs a program with an input file and an output file.
+typedef struct {
+	// The job's program source path.
+	const char *programPath;
+	
+	// The job's input path, or "-" if the job has no input.
+	const char *inputPath;
+	
+	// The job's output path, or "-" if the job's output is discarded.
+	const char *outputPath;
+	
+	// The index of the job's program in the batch.
+	int program;
+	
+	// The job's state if it has been started in slices, or NULL.
+	BatchRun *run;
+	
+	// Whether the job could not be run.
+	bool isFailed;
+} BatchJob;
+
+// A batch of jobs run by worker threads.
+typedef struct {
+	// The batch's manifest text. Paths in the batch point into the text.
+	char *text;
+	
+	// The number of unique programs in the batch.
+	int programCount;
+	
+	// The unique programs in the batch.
+	BatchProgram *programs;
+	
+	// The number of jobs in the batch.
+	int jobCount;
+	
+	// The jobs in the batch.
+	BatchJob *jobs;
+	
+	// The number of worker threads.
+	int threadCount;
+	
+	// The buffering mode for each job's input and output.
+	IOMode mode;
+	
+	// The output buffer size for each job in bytes.
+	size_t bufferSize;
+	
+	// The engine that runs each job's bytecode.
+	Engine engine;
+	
+	// The number of loop iterations in each slice of a job, or 0 to run each
+	// job to completion.
+	uint64_t sliceSize;
+	
+	// The maximum number of jobs started in slices but not finished at once.
+	int residentLimit;
+	
+	// The maximum number of loop iterations for each job, or 0 for no limit.
+	uint64_t fuel;
+	
+	// The index of the next item for a worker thread to claim.
+	int next;
+#ifndef _WIN32
+
+	// The lock for claiming items.
+	pthread_mutex_t lock;
+#endif // _WIN32
+} Batch;
+
+// A worker thread's task, which is run with a batch.
+typedef void *BatchTask(void *batch);
+
+// Return whether a character separates fields in a manifest line.
+static bool isFieldSeparator(char character) {
+	return character == ' ' || character == '\t' || character == '\r';
+}
+
+// Split the next field from a manifest line in place and return it, or NULL if
+// the line has no more fields.
+static char *splitField(char **line) {
+	char *field = *line;
+	
+	while (isFieldSeparator(*field)) {
+		field++;
+	}
+	
+	if (*field == '\0') {
+		*line = field;
+		return NULL;
+	}
+	
+	char *end = field;
+	
+	while (*end != '\0' && !isFieldSeparator(*end)) {
+		end++;
+	}
+	
+	if (*end != '\0') {
+		*end++ = '\0';
+	}
+	
+	*line = end;
+	return field;
+}
+
+// Append a job to a batch from a manifest line and return whether the line
+// is valid. Blank lines and comment lines starting with '#' add no job.
+static bool appendBatchJob(Batch *batch, char *line, int *jobCapacity) {
+	char *programPath = splitField(&line);
+	
+	if (programPath == NULL || programPath[0] == '#') {
+		return true;
+	}
+	
+	char *inputPath = splitField(&line);
+	char *outputPath = splitField(&line);
+	
+	if (outputPath == NULL || splitField(&line) != NULL) {
+		return false;
+	}
+	
+	if (batch->jobCount == *jobCapacity) {
+		*jobCapacity = *jobCapacity != 0 ? *jobCapacity * 2 : 64;
+		batch->jobs = (BatchJob*)realloc(batch->jobs, *jobCapacity * sizeof(BatchJob));
+		
+		if (batch->jobs == NULL) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	
+	BatchJob *job = &batch->jobs[batch->jobCount++];
+	job->programPath = programPath;
+	job->inputPath = inputPath;
+	job->outputPath = outputPath;
+	job->program = -1;
+	job->run = NULL;
+	job->isFailed = false;
+	return true;
+}
+
+// Load a batch's jobs from a manifest path and return whether the manifest is
+// valid. Each line of the manifest names a program path, an input path, and an
+// output path separated by spaces or tabs.
+static bool loadBatchJobs(Batch *batch, const char *path) {
+	Source source;
+	
+	if (!loadSource(&source, path)) {
+		return false;
+	}
+	
+	batch->text = (char*)malloc((source.size + 1) * sizeof(char));
+	
+	if (batch->text == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	memcpy(batch->text, source.bytes, source.size);
+	batch->text[source.size] = '\0';
+	freeSource(&source);
+	int jobCapacity = 0;
+	char *line = batch->text;
+	
+	for (int lineNumber = 1; line != NULL; lineNumber++) {
+		char *end = strchr(line, '\n');
+		
+		if (end != NULL) {
+			*end++ = '\0';
+		}
+		
+		if (!appendBatchJob(batch, line, &jobCapacity)) {
+			fprintf(stderr, "Invalid job on line %d of '%s', expected a program, input, and output path.\n", lineNumber, path);
+			return false;
+		}
+		
+		line = end;
+	}
+	
+	return true;
+}
+
+// Compare batch jobs by their program paths.
+static int compareJobPrograms(const void *first, const void *second) {
+	const BatchJob *a = *(const BatchJob *const*)first;
+	const BatchJob *b = *(const BatchJob *const*)second;
+	return strcmp(a->programPath, b->programPath);
+}
+
+// Find a batch's unique programs and assign them to its jobs.
+static void findBatchPrograms(Batch *batch) {
+	// Jobs are sorted by program path so that jobs with the same program are
+	// adjacent.
+	BatchJob **sorted = (BatchJob**)malloc(batch->jobCount * sizeof(BatchJob*));
+	batch->programs = (BatchProgram*)malloc(batch->jobCount * sizeof(BatchProgram));
+	
+	if (sorted == NULL || batch->programs == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	for (int i = 0; i < batch->jobCount; i++) {
+		sorted[i] = &batch->jobs[i];
+	}
+	
+	qsort(sorted, batch->jobCount, sizeof(BatchJob*), compareJobPrograms);
+	
+	for (int i = 0; i < batch->jobCount; i++) {
+		if (i == 0 || strcmp(sorted[i]->programPath, sorted[i - 1]->programPath) != 0) {
+			BatchProgram *program = &batch->programs[batch->programCount++];
+			program->path = sorted[i]->programPath;
+			program->isCompiled = false;
+		}
+		
+		sorted[i]->program = batch->programCount - 1;
+	}
+	
+	free(sorted);
+}
+
+// Claim the index of the next item for a worker thread to process, or return
+// -1 if every item has been claimed.
+static int claimBatchItem(Batch *batch, int count) {
+#ifndef _WIN32
+	pthread_mutex_lock(&batch->lock);
+#endif // _WIN32
+	int index = batch->next < count ? batch->next++ : -1;
+#ifndef _WIN32
+	pthread_mutex_unlock(&batch->lock);
+#endif // _WIN32
+	return index;
+}
+
+// Compile a batch's unique programs until every program has been claimed.
+static void *compileBatchPrograms(void *argument) {
+	Batch *batch = (Batch*)argument;
+	
+	for (int i = claimBatchItem(batch, batch->programCount); i >= 0; i = claimBatchItem(batch, batch->programCount)) {
+		BatchProgram *program = &batch->programs[i];
+		program->isCompiled = compilePath(program->path, &program->bytecode);
+	}
+	
+	return NULL;
+}
+
+// Open a batch job's input and output files and return whether they could be
+// opened. Files named "-" are not opened and are set to NULL.
+static bool openBatchFiles(const BatchJob *job, FILE **input, FILE **output) {
+	*input = NULL;
+	*output = NULL;
+	
+	if (strcmp(job->inputPath, "-") != 0 && (*input = fopen(job->inputPath, "rb")) == NULL) {
+		fprintf(stderr, "Could not open '%s', file may not exist.\n", job->inputPath);
+		return false;
+	}
+	
+	if (strcmp(job->outputPath, "-") != 0 && (*output = fopen(job->outputPath, "wb")) == NULL) {
+		fprintf(stderr, "Could not open '%s' for writing.\n", job->outputPath);
+		
+		if (*input != NULL) {
+			fclose(*input);
+		}
+		
+		return false;
+	}
+	
+	return true;
+}
+
+// Close a batch job's optional input and output files and return whether the
+// output was written without errors.
+static bool closeBatchFiles(const BatchJob *job, FILE *input, FILE *output) {
+	if (input != NULL) {
+		fclose(input);
+	}
+	
+	if (output != NULL && (ferror(output) | fclose(output)) != 0) {
+		fprintf(stderr, "Encountered an error while writing '%s'.\n", job->outputPath);
+		return false;
+	}
+	
+	return true;
+}
+
+// Run a batch job with a worker thread's tape and I/O and return whether it was
+// run.
+static bool runBatchJob(const Batch *batch, const BatchJob *job, Tape *tape, IO *io) {
+	const BatchProgram *program = &batch->programs[job->program];
+	FILE *input;
+	FILE *output;
+	
+	// Programs that could not be compiled have already been reported.
+	if (!program->isCompiled || !openBatchFiles(job, &input, &output)) {
+		return false;
+	}
+	
+	memset(tape->memory, 0, tape->size);
+	initIO(io, input, output, batch->mode, batch->bufferSize);
+	bool isHalted = true;
+	
+	if (batch->fuel == 0) {
+		interpretBytecode(program->bytecode.bytes, tape, io, batch->engine);
+	} else {
+		VMState state = {0, 0};
+		isHalted = meterBytecode(program->bytecode.bytes, tape, io, &state, batch->fuel);
+	}
+	
+	bool isRun = closeBatchFiles(job, input, output);
+	
+	if (!isHalted) {
+		fprintf(stderr, "Job running '%s' ran out of fuel.\n", job->programPath);
+	}
+	
+	return isRun && isHalted;
+}
+
+// Start a batch job in slices and return whether it could be started.
+static bool startBatchRun(const Batch *batch, BatchJob *job) {
+	if (!batch->programs[job->program].isCompiled) {
+		return false;
+	}
+	
+	// The run is zeroed so that its I/O buffers are allocated when the I/O is
+	// first initialized.
+	BatchRun *run = (BatchRun*)calloc(1, sizeof(BatchRun));
+	
+	if (run == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	if (!initTape(&run->tape, 0)) {
+		fprintf(stderr, "Could not allocate memory for the tape.\n");
+		free(run);
+		return false;
+	}
+	
+	if (!openBatchFiles(job, &run->input, &run->output)) {
+		freeTape(&run->tape);
+		free(run);
+		return false;
+	}
+	
+	initIO(&run->io, run->input, run->output, batch->mode, batch->bufferSize);
+	run->fuel = batch->fuel;
+	job->run = run;
+	return true;
+}
+
+// Finish a batch job that was run in slices and return whether it was run.
+static bool finishBatchRun(BatchJob *job) {
+	BatchRun *run = job->run;
+	bool isRun = closeBatchFiles(job, run->input, run->output);
+	freeIO(&run->io);
+	freeTape(&run->tape);
+	free(run);
+	job->run = NULL;
+	return isRun;
+}
+
+// Run a slice of a batch job, starting it if needed, and return whether the job
+// finished.
+static bool runBatchSlice(void *argument, int index) {
+	Batch *batch = (Batch*)argument;
+	BatchJob *job = &batch->jobs[index];
+	
+	if (job->run == NULL && !startBatchRun(batch, job)) {
+		job->isFailed = true;
+		return true;
+	}
+	
+	BatchRun *run = job->run;
+	uint64_t fuel = run->fuel != 0 && run->fuel < batch->sliceSize ? run->fuel : batch->sliceSize;
+	
+	if (meterBytecode(batch->programs[job->program].bytecode.bytes, &run->tape, &run->io, &run->state, fuel)) {
+		job->isFailed = !finishBatchRun(job);
+		return true;
+	}
+	
+	// Jobs with a limit stop when they have used all of their fuel.
+	if (run->fuel == 0 || (run->fuel -= fuel) != 0) {
+		return false;
+	}
+	
+	finishBatchRun(job);
+	fprintf(stderr, "Job running '%s' ran out of fuel.\n", job->programPath);
+	job->isFailed = true;
+	return true;
+}
+
+// Run a batch's jobs with a tape and I/O owned by a worker thread until every
+// job has been claimed.
+static void *runBatchJobs(void *argument) {
+	Batch *batch = (Batch*)argument;
+	Tape tape;
+	IO io = {0};
+	bool hasTape = initTape(&tape, 0);
+	
+	if (!hasTape) {
+		fprintf(stderr, "Could not allocate memory for the tape.\n");
+	}
+	
+	for (int i = claimBatchItem(batch, batch->jobCount); i >= 0; i = claimBatchItem(batch, batch->jobCount)) {
+		BatchJob *job = &batch->jobs[i];
+		job->isFailed = !hasTape || !runBatchJob(batch, job, &tape, &io);
+	}
+	
+	if (hasTape) {
+		freeTape(&tape);
+	}
+	
+	freeIO(&io);
+	return NULL;
+}
+
+// Run a task on a batch's worker threads and wait for them to finish.
+static void runBatchTask(Batch *batch, BatchTask *task) {
+	batch->next = 0;
+#ifndef _WIN32
+	pthread_t *threads = (pthread_t*)malloc(batch->threadCount * sizeof(pthread_t));
+	
+	if (threads == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	int startedCount = 0;
+	
+	while (startedCount < batch->threadCount && pthread_create(&threads[startedCount], NULL, task, batch) == 0) {
+		startedCount++;
+	}
+	
+	// The task is run on the calling thread if no threads could be started.
+	if (startedCount == 0) {
+		task(batch);
+	}
+	
+	for (int i = 0; i < startedCount; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	
+	free(threads);
+#else // _WIN32
+	task(batch);
+#endif // _WIN32
+}
+
+// Get the number of worker threads for a batch from a requested number, or one
+// per processor if the number is 0.
+static int getBatchThreadCount(const Batch *batch, size_t threadCount) {
+	if (threadCount == 0) {
+#ifndef _WIN32
+		long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+		threadCount = processorCount > 0 ? (size_t)processorCount : 1;
+#else // _WIN32
+		threadCount = 1;
+#endif // _WIN32
+	}
+	
+	// There is no use for more threads than jobs.
+	if (threadCount > (size_t)batch->jobCount) {
+		threadCount = (size_t)batch->jobCount;
+	}
+	
+	return threadCount > 0 ? (int)threadCount : 1;
+}
+
+// Run a batch of jobs from a manifest path on a number of worker threads, or
+// one per processor if the number is 0. Each job's input and output are
+// buffered with a buffering mode and output buffer size, and its bytecode is
+// run with an engine. If a slice size is given, jobs are instead run in slices
+// of that many loop iterations, with at most a resident limit of jobs started
+// at once. Jobs that do not halt within a number of loop iterations, unless the
+// number is 0, are stopped and fail. Return whether every job was run.
+bool runBatch(const char *path, size_t threadCount, IOMode mode, size_t bufferSize, Engine engine, uint64_t sliceSize, size_t residentLimit, uint64_t fuel) {
+	Batch batch = {0};
+	
+	if (!loadBatchJobs(&batch, path)) {
+		free(batch.jobs);
+		free(batch.text);
+		return false;
+	}
+	
+	findBatchPrograms(&batch);
+	batch.threadCount = getBatchThreadCount(&batch, threadCount);
+	batch.mode = mode;
+	batch.bufferSize = bufferSize;
+	batch.engine = engine;
+	batch.sliceSize = sliceSize;
+	batch.residentLimit = residentLimit < INT32_MAX ? (int)residentLimit : INT32_MAX;
+	batch.fuel = fuel;
+#ifndef _WIN32
+	pthread_mutex_init(&batch.lock, NULL);
+#endif // _WIN32
+
+	// Every unique program is compiled once before any job is run.
+	runBatchTask(&batch, compileBatchPrograms);
+	
+	// Jobs run in slices share the workers fairly, so long jobs do not delay
+	// short jobs that are started after them.
+	if (batch.sliceSize != 0) {
+		runScheduler(batch.jobCount, batch.threadCount, batch.residentLimit, runBatchSlice, &batch);
+	} else {
+		runBatchTask(&batch, runBatchJobs);
+	}
+#ifndef _WIN32
+	pthread_mutex_destroy(&batch.lock);
+#endif // _WIN32
+	int failedCount = 0;
+	
+	for (int i = 0; i < batch.jobCount; i++) {
+		failedCount += batch.jobs[i].isFailed;
+	}
+	
+	for (int i = 0; i < batch.programCount; i++) {
+		if (batch.programs[i].isCompiled) {
+			freeBytecode(&batch.programs[i].bytecode);
+		}
+	}
+	
+	if (failedCount > 0) {
+		fprintf(stderr, "%d of %d jobs could not be run.\n", failedCount, batch.jobCount);
+	}
+	
+	free(batch.programs);
+	free(batch.jobs);
+	free(batch.text);
+	return failedCount == 0;
+}
@@ -0,0 +1,20 @@
+#ifndef BRAINIAC_BATCH_H
+#define BRAINIAC_BATCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "io.h"
+#include "vm.h"
+
+// Run a batch of jobs from a manifest path on a number of worker threads, or
+// one per processor if the number is 0. Each job's input and output are
+// buffered with a buffering mode and output buffer size, and its bytecode is
+// run with an engine. If a slice size is given, jobs are instead run in slices
+// of that many loop iterations, with at most a resident limit of jobs started
+// at once. Jobs that do not halt within a number of loop iterations, unless the
+// number is 0, are stopped and fail. Return whether every job was run.
+bool runBatch(const char *path, size_t threadCount, IOMode mode, size_t bufferSize, Engine engine, uint64_t sliceSize, size_t residentLimit, uint64_t fuel);
+
+#endif // BRAINIAC_BATCH_H
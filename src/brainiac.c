@@ -0,0 +1,281 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "brainiac.h"
+#include "compiler.h"
+#include "io.h"
+#include "tape.h"
+#include "vm.h"
+
+// The default size of a context's output buffer in bytes.
+#define CONTEXT_BUFFER_SIZE 65536
+
+// The size of a context's input buffer in bytes, which matches the block size
+// used by custom I/O.
+#define CONTEXT_INPUT_SIZE 65536
+
+// A compiled program.
+struct BrainiacProgram {
+	// The program's bytecode.
+	Bytecode bytecode;
+};
+
+// A context that runs programs.
+struct BrainiacContext {
+	// The context's wrapping tape.
+	Tape tape;
+	
+	// The context's I/O, which reads and writes through the context.
+	IO io;
+	
+	// The state of the context's last run.
+	VMState state;
+	
+	// The optional reader for input.
+	BrainiacReader *reader;
+	
+	// The optional writer for output.
+	BrainiacWriter *writer;
+	
+	// The user data passed to the reader and writer.
+	void *userData;
+	
+	// The input buffer, or NULL if there is no input buffer.
+	const uint8_t *input;
+	
+	// The input buffer's size in bytes.
+	size_t inputSize;
+	
+	// The index of the next byte to read from the input buffer.
+	size_t inputNext;
+	
+	// The output buffer, or NULL if there is no output buffer.
+	uint8_t *output;
+	
+	// The output buffer's capacity in bytes.
+	size_t outputCapacity;
+	
+	// The number of bytes output by the last run.
+	size_t outputSize;
+};
+
+// Get a message from a status.
+const char *brainiacGetStatusMessage(BrainiacStatus status) {
+	switch (status) {
+		case BRAINIAC_OK: return "Success.";
+		case BRAINIAC_SYNTAX_ERROR: return "The source code has unmatched brackets.";
+		case BRAINIAC_OUT_OF_MEMORY: return "Memory could not be allocated.";
+		case BRAINIAC_OUTPUT_TRUNCATED: return "The output did not fit in the output buffer.";
+		case BRAINIAC_OUT_OF_FUEL: return "The program was paused before halting.";
+	}
+	
+	return "Unknown status.";
+}
+
+// Return whether source code and its size in bytes has matching brackets. The
+// parser reports unmatched brackets to standard error, so they are found here
+// first.
+static bool hasMatchingBrackets(const char *source, size_t size) {
+	size_t depth = 0;
+	
+	for (size_t i = 0; i < size; i++) {
+		if (source[i] == '[') {
+			depth++;
+		} else if (source[i] == ']' && depth-- == 0) {
+			return false;
+		}
+	}
+	
+	return depth == 0;
+}
+
+// Compile a program from source code and its size in bytes.
+BrainiacStatus brainiacCompile(const char *source, size_t size, BrainiacProgram **program) {
+	if (!hasMatchingBrackets(source, size)) {
+		return BRAINIAC_SYNTAX_ERROR;
+	}
+	
+	BrainiacProgram *compiled = (BrainiacProgram*)malloc(sizeof(BrainiacProgram));
+	
+	if (compiled == NULL) {
+		return BRAINIAC_OUT_OF_MEMORY;
+	}
+	
+	// The brackets have already been matched, so the program can only fail to
+	// compile if memory could not be allocated.
+	if (!compileSourceBytes(source, size, &compiled->bytecode)) {
+		free(compiled);
+		return BRAINIAC_OUT_OF_MEMORY;
+	}
+	
+	*program = compiled;
+	return BRAINIAC_OK;
+}
+
+// Free a compiled program.
+void brainiacFreeProgram(BrainiacProgram *program) {
+	if (program != NULL) {
+		freeBytecode(&program->bytecode);
+		free(program);
+	}
+}
+
+// Read input for a context's program from its reader or input buffer.
+static size_t readContextInput(void *data, uint8_t *bytes, size_t capacity) {
+	BrainiacContext *context = (BrainiacContext*)data;
+	
+	if (context->reader != NULL) {
+		return context->reader(context->userData, bytes, capacity);
+	}
+	
+	size_t count = context->inputSize - context->inputNext;
+	count = count < capacity ? count : capacity;
+	
+	if (count > 0) {
+		memcpy(bytes, context->input + context->inputNext, count);
+		context->inputNext += count;
+	}
+	
+	return count;
+}
+
+// Write output from a context's program to its writer or output buffer.
+static void writeContextOutput(void *data, const uint8_t *bytes, size_t count) {
+	BrainiacContext *context = (BrainiacContext*)data;
+	
+	if (context->writer != NULL) {
+		context->writer(context->userData, bytes, count);
+	} else if (context->outputSize < context->outputCapacity) {
+		size_t space = context->outputCapacity - context->outputSize;
+		memcpy(context->output + context->outputSize, bytes, count < space ? count : space);
+	}
+	
+	context->outputSize += count;
+}
+
+// Create a context with an output buffer size in bytes, or a default size if
+// the size is 0.
+BrainiacStatus brainiacNewContext(size_t bufferSize, BrainiacContext **context) {
+	BrainiacContext *created = (BrainiacContext*)calloc(1, sizeof(BrainiacContext));
+	
+	if (created == NULL) {
+		return BRAINIAC_OUT_OF_MEMORY;
+	}
+	
+	if (!initTape(&created->tape, 0)) {
+		free(created);
+		return BRAINIAC_OUT_OF_MEMORY;
+	}
+	
+	// The I/O buffers are allocated here so that initializing the I/O for each
+	// run reuses them instead of exiting if they cannot be allocated.
+	created->io.output.capacity = bufferSize != 0 ? bufferSize : CONTEXT_BUFFER_SIZE;
+	created->io.output.bytes = (uint8_t*)malloc(created->io.output.capacity);
+	created->io.input.capacity = CONTEXT_INPUT_SIZE;
+	created->io.input.bytes = (uint8_t*)malloc(created->io.input.capacity);
+	
+	if (created->io.output.bytes == NULL || created->io.input.bytes == NULL) {
+		brainiacFreeContext(created);
+		return BRAINIAC_OUT_OF_MEMORY;
+	}
+	
+	// New contexts are reset so that a program can be resumed from the start
+	// without resetting the context first.
+	brainiacReset(created);
+	*context = created;
+	return BRAINIAC_OK;
+}
+
+// Free a context.
+void brainiacFreeContext(BrainiacContext *context) {
+	if (context != NULL) {
+		freeIO(&context->io);
+		freeTape(&context->tape);
+		free(context);
+	}
+}
+
+// Set a context's programs to read input from an optional reader and write
+// output to an optional writer, with user data passed to both.
+void brainiacSetCallbacks(BrainiacContext *context, BrainiacReader *reader, BrainiacWriter *writer, void *userData) {
+	context->reader = reader;
+	context->writer = writer;
+	context->userData = userData;
+	context->input = NULL;
+	context->inputSize = 0;
+	context->output = NULL;
+	context->outputCapacity = 0;
+}
+
+// Set a context's programs to read input from a buffer and write output to a
+// buffer with a capacity in bytes.
+void brainiacSetBuffers(BrainiacContext *context, const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputCapacity) {
+	context->reader = NULL;
+	context->writer = NULL;
+	context->userData = NULL;
+	context->input = input;
+	context->inputSize = input != NULL ? inputSize : 0;
+	context->output = output;
+	context->outputCapacity = output != NULL ? outputCapacity : 0;
+}
+
+// Get the status of a context's halted program from its output.
+static BrainiacStatus getOutputStatus(const BrainiacContext *context) {
+	if (context->writer == NULL && context->output != NULL && context->outputSize > context->outputCapacity) {
+		return BRAINIAC_OUTPUT_TRUNCATED;
+	}
+	
+	return BRAINIAC_OK;
+}
+
+// Clear a context's tape and run a program on it until the program halts.
+// Programs that are not resumable are run without metering loop iterations.
+BrainiacStatus brainiacRun(BrainiacContext *context, const BrainiacProgram *program) {
+	brainiacReset(context);
+	resumeBytecode(program->bytecode.bytes, &context->tape, &context->io, &context->state);
+	return getOutputStatus(context);
+}
+
+// Clear a context's tape and move its memory pointer and program counter to the
+// start.
+void brainiacReset(BrainiacContext *context) {
+	memset(context->tape.memory, 0, context->tape.size);
+	context->state.pc = 0;
+	context->state.pointer = 0;
+	context->inputNext = 0;
+	context->outputSize = 0;
+	initCustomIO(&context->io, readContextInput, writeContextOutput, context, context->io.output.capacity);
+}
+
+// Resume a program on a context from its memory pointer and program counter
+// until it halts or takes a number of loop iterations, or until it halts if the
+// number is 0.
+BrainiacStatus brainiacResume(BrainiacContext *context, const BrainiacProgram *program, uint64_t fuel) {
+	if (!meterBytecode(program->bytecode.bytes, &context->tape, &context->io, &context->state, fuel)) {
+		return BRAINIAC_OUT_OF_FUEL;
+	}
+	
+	return getOutputStatus(context);
+}
+
+// Get the number of bytes output by a context's last run.
+size_t brainiacGetOutputSize(const BrainiacContext *context) {
+	return context->outputSize;
+}
+
+// Get the index of a context's memory pointer on its tape.
+size_t brainiacGetPointer(const BrainiacContext *context) {
+	return context->state.pointer;
+}
+
+// Get a context's program counter as an address in its program's bytecode.
+size_t brainiacGetProgramCounter(const BrainiacContext *context) {
+	return context->state.pc;
+}
+
+// Get a context's tape and fill its size in cells.
+uint8_t *brainiacGetTape(BrainiacContext *context, size_t *size) {
+	*size = context->tape.size;
+	return context->tape.memory;
+}
@@ -0,0 +1,102 @@
+#ifndef BRAINIAC_H
+#define BRAINIAC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Marks a function exported by the Brainiac library.
+#ifdef __GNUC__
+#define BRAINIAC_API __attribute__((visibility("default")))
+#else // __GNUC__
+#define BRAINIAC_API
+#endif // __GNUC__
+
+// The status of a call to the Brainiac library.
+typedef enum {
+	BRAINIAC_OK, // The call succeeded.
+	BRAINIAC_SYNTAX_ERROR, // The source code has unmatched brackets.
+	BRAINIAC_OUT_OF_MEMORY, // Memory could not be allocated.
+	BRAINIAC_OUTPUT_TRUNCATED, // The program halted with more output than its buffer could hold.
+	BRAINIAC_OUT_OF_FUEL, // The program was paused before halting and can be resumed.
+} BrainiacStatus;
+
+// Read up to a capacity of input bytes for a context's program and return the
+// number of bytes read, or 0 at the end of input.
+typedef size_t BrainiacReader(void *userData, uint8_t *bytes, size_t capacity);
+
+// Write a number of output bytes from a context's program.
+typedef void BrainiacWriter(void *userData, const uint8_t *bytes, size_t count);
+
+// A compiled program. Programs are immutable and can be run by any number of
+// contexts at once.
+typedef struct BrainiacProgram BrainiacProgram;
+
+// A context that owns a tape, a memory pointer, a program counter, and I/O
+// buffers. A context runs one program at a time, but separate contexts can be
+// used by separate threads.
+typedef struct BrainiacContext BrainiacContext;
+
+// Get a message from a status.
+BRAINIAC_API const char *brainiacGetStatusMessage(BrainiacStatus status);
+
+// Compile a program from source code and its size in bytes. Nothing is printed
+// and the source code is not kept.
+BRAINIAC_API BrainiacStatus brainiacCompile(const char *source, size_t size, BrainiacProgram **program);
+
+// Free a compiled program.
+BRAINIAC_API void brainiacFreeProgram(BrainiacProgram *program);
+
+// Create a context with an output buffer size in bytes, or a default size if
+// the size is 0. This is the only call that allocates memory for running
+// programs.
+BRAINIAC_API BrainiacStatus brainiacNewContext(size_t bufferSize, BrainiacContext **context);
+
+// Free a context.
+BRAINIAC_API void brainiacFreeContext(BrainiacContext *context);
+
+// Set a context's programs to read input from an optional reader and write
+// output to an optional writer, with user data passed to both. Programs without
+// a reader have no input and programs without a writer discard their output.
+BRAINIAC_API void brainiacSetCallbacks(BrainiacContext *context, BrainiacReader *reader, BrainiacWriter *writer, void *userData);
+
+// Set a context's programs to read input from a buffer and write output to a
+// buffer with a capacity in bytes. Output beyond the capacity is discarded.
+// The buffers must outlive the runs that use them.
+BRAINIAC_API void brainiacSetBuffers(BrainiacContext *context, const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputCapacity);
+
+// Clear a context's tape and run a program on it until the program halts.
+BRAINIAC_API BrainiacStatus brainiacRun(BrainiacContext *context, const BrainiacProgram *program);
+
+// Clear a context's tape and move its memory pointer and program counter to the
+// start so that a program can be resumed from the start.
+BRAINIAC_API void brainiacReset(BrainiacContext *context);
+
+// Resume a program on a context from its memory pointer and program counter
+// until it halts or takes a number of loop iterations, or until it halts if the
+// number is 0. Programs that have not halted return BRAINIAC_OUT_OF_FUEL and
+// can be resumed with more iterations. A context must keep resuming the same
+// program until it halts or is reset.
+BRAINIAC_API BrainiacStatus brainiacResume(BrainiacContext *context, const BrainiacProgram *program, uint64_t fuel);
+
+// Get the number of bytes output by a context's last run, including any bytes
+// that were discarded.
+BRAINIAC_API size_t brainiacGetOutputSize(const BrainiacContext *context);
+
+// Get the index of a context's memory pointer on its tape.
+BRAINIAC_API size_t brainiacGetPointer(const BrainiacContext *context);
+
+// Get a context's program counter as an address in its program's bytecode.
+BRAINIAC_API size_t brainiacGetProgramCounter(const BrainiacContext *context);
+
+// Get a context's tape and fill its size in cells.
+BRAINIAC_API uint8_t *brainiacGetTape(BrainiacContext *context, size_t *size);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // BRAINIAC_H
@@ -0,0 +1,266 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "cache.h"
+#include "opcode.h"
+
+// The magic number at the start of a cached image.
+#define CACHE_MAGIC "BFC\x1a"
+
+// The version of the cached image format and the compiler that produced it.
+// This must be changed whenever the same source code would compile to
+// different bytecode.
+#define CACHE_VERSION 2
+
+// Flags describing how a cached image's bytecode was compiled. Images with
+// flags that are not supported are not loaded.
+#define CACHE_FLAGS 0
+
+// The size of a cached image's header in bytes. The header contains the magic
+// number, the version, the flags, a hash of the opcode table, the source
+// code's digest and size, and the bytecode's size, in little-endian order.
+// Images are only loaded for source code with the same digest, so colliding
+// sources are never run with each other's bytecode.
+#define CACHE_HEADER_SIZE (32 + DIGEST_SIZE)
+
+// The FNV-1a offset basis for 64-bit hashes.
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+
+// The FNV-1a prime for 64-bit hashes.
+#define FNV_PRIME 0x100000001b3ULL
+
+// Update an FNV-1a hash with bytes.
+static uint64_t hashBytes(uint64_t hash, const void *bytes, size_t count) {
+	const uint8_t *next = (const uint8_t*)bytes;
+	
+	for (size_t i = 0; i < count; i++) {
+		hash = (hash ^ next[i]) * FNV_PRIME;
+	}
+	
+	return hash;
+}
+
+// Get a hash of the opcode table so that images are not loaded by builds with
+// different opcodes.
+static uint32_t getOpcodesHash() {
+	uint64_t hash = FNV_OFFSET;
+	
+	for (int i = 0; i < OPCODE_COUNT; i++) {
+		const OpcodeInfo *info = getOpcodeInfo((Opcode)i);
+		hash = hashBytes(hash, info->name, strlen(info->name) + 1);
+		uint8_t layout[OPCODE_MAX_SEQUENCE + 1] = {(uint8_t)info->operands};
+		
+		for (int j = 0; j < info->length; j++) {
+			layout[j + 1] = (uint8_t)info->sequence[j];
+		}
+		
+		hash = hashBytes(hash, layout, sizeof(layout));
+	}
+	
+	return (uint32_t)(hash ^ (hash >> 32));
+}
+
+// Put a little-endian U32 value to a header.
+static void putHeaderU32(uint8_t *header, int offset, uint32_t value) {
+	for (int i = 0; i < 4; i++) {
+		header[offset + i] = (value >> (i * 8)) & 0xff;
+	}
+}
+
+// Put a little-endian U64 value to a header.
+static void putHeaderU64(uint8_t *header, int offset, uint64_t value) {
+	putHeaderU32(header, offset, (uint32_t)value);
+	putHeaderU32(header, offset + 4, (uint32_t)(value >> 32));
+}
+
+// Initialize a cached image's header from a cache key and a bytecode size.
+static void initHeader(uint8_t *header, const CacheKey *key, uint64_t bytecodeSize) {
+	memcpy(header, CACHE_MAGIC, 4);
+	putHeaderU32(header, 4, CACHE_VERSION);
+	putHeaderU32(header, 8, CACHE_FLAGS);
+	putHeaderU32(header, 12, getOpcodesHash());
+	memcpy(header + 16, key->digest, DIGEST_SIZE);
+	putHeaderU64(header, 16 + DIGEST_SIZE, key->size);
+	putHeaderU64(header, 24 + DIGEST_SIZE, bytecodeSize);
+}
+
+// Initialize a cache key from source code and its size in bytes.
+void initCacheKey(CacheKey *key, const char *source, size_t size) {
+	getDigest(key->digest, source, size);
+	key->size = (uint64_t)size;
+}
+
+#ifndef _WIN32
+// Get the path to a cached image from a cache key, optionally making the cache
+// directory. Return NULL if there is no cache directory.
+static char *getCachePath(const CacheKey *key, bool isMade) {
+	const char *base = getenv("BRAINIAC_CACHE_DIR");
+	const char *suffix = "";
+	
+	if (base == NULL || base[0] == '\0') {
+		base = getenv("XDG_CACHE_HOME");
+		suffix = "/brainiac";
+		
+		if (base == NULL || base[0] == '\0') {
+			base = getenv("HOME");
+			suffix = "/.cache/brainiac";
+		}
+	}
+	
+	if (base == NULL || base[0] == '\0') {
+		return NULL;
+	}
+	
+	size_t size = strlen(base) + strlen(suffix) + 22;
+	char *path = (char*)malloc(size * sizeof(char));
+	
+	if (path == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	// The cache directory and any of its parents in the suffix are made in
+	// order.
+	size_t suffixLength = strlen(suffix);
+	
+	for (size_t i = 0; isMade && i <= suffixLength; i++) {
+		if (i < suffixLength && (i == 0 || suffix[i] != '/')) {
+			continue;
+		}
+		
+		snprintf(path, size, "%s%.*s", base, (int)i, suffix);
+		
+		if (mkdir(path, 0777) != 0 && errno != EEXIST) {
+			free(path);
+			return NULL;
+		}
+	}
+	
+	// Images are named by the start of their source code's digest.
+	int length = snprintf(path, size, "%s%s/", base, suffix);
+	
+	for (int i = 0; i < 8; i++) {
+		length += snprintf(path + length, size - (size_t)length, "%02x", key->digest[i]);
+	}
+	
+	snprintf(path + length, size - (size_t)length, ".bfc");
+	return path;
+}
+#endif // _WIN32
+
+// Map cached bytecode from a cache key and return whether valid bytecode was
+// cached.
+bool loadCache(const CacheKey *key, Bytecode *bytecode) {
+#ifndef _WIN32
+	char *path = getCachePath(key, false);
+	
+	if (path == NULL) {
+		return false;
+	}
+	
+	int descriptor = open(path, O_RDONLY);
+	free(path);
+	
+	if (descriptor < 0) {
+		return false;
+	}
+	
+	struct stat status;
+	
+	if (fstat(descriptor, &status) != 0 || status.st_size <= CACHE_HEADER_SIZE) {
+		close(descriptor);
+		return false;
+	}
+	
+	size_t mappingSize = (size_t)status.st_size;
+	void *mapping = mmap(NULL, mappingSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	close(descriptor);
+	
+	if (mapping == MAP_FAILED) {
+		return false;
+	}
+	
+	uint8_t header[CACHE_HEADER_SIZE];
+	initHeader(header, key, mappingSize - CACHE_HEADER_SIZE);
+	
+	if (memcmp(mapping, header, CACHE_HEADER_SIZE) != 0) {
+		munmap(mapping, mappingSize);
+		return false;
+	}
+	
+	bytecode->bytes = (uint8_t*)mapping + CACHE_HEADER_SIZE;
+	bytecode->size = mappingSize - CACHE_HEADER_SIZE;
+	bytecode->mapping = mapping;
+	bytecode->mappingSize = mappingSize;
+	return true;
+#else // _WIN32
+	(void)key;
+	(void)bytecode;
+	return false;
+#endif // _WIN32
+}
+
+// Store bytecode in the cache from a cache key and return whether it could be
+// stored.
+bool storeCache(const CacheKey *key, const Bytecode *bytecode) {
+#ifndef _WIN32
+	char *path = getCachePath(key, true);
+	
+	if (path == NULL) {
+		return false;
+	}
+	
+	// The image is written to a temporary file and renamed over the cached
+	// image so that images are never seen partially written.
+	size_t size = strlen(path) + 24;
+	char *temporaryPath = (char*)malloc(size * sizeof(char));
+	
+	if (temporaryPath == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	snprintf(temporaryPath, size, "%s.%ld.tmp", path, (long)getpid());
+	FILE *file = fopen(temporaryPath, "wb");
+	bool isStored = false;
+	
+	if (file != NULL) {
+		uint8_t header[CACHE_HEADER_SIZE];
+		initHeader(header, key, bytecode->size);
+		isStored = fwrite(header, sizeof(uint8_t), CACHE_HEADER_SIZE, file) == CACHE_HEADER_SIZE;
+		isStored = isStored && fwrite(bytecode->bytes, sizeof(uint8_t), bytecode->size, file) == bytecode->size;
+		isStored = fclose(file) == 0 && isStored;
+		isStored = isStored && rename(temporaryPath, path) == 0;
+		
+		if (!isStored) {
+			remove(temporaryPath);
+		}
+	}
+	
+	free(temporaryPath);
+	free(path);
+	return isStored;
+#else // _WIN32
+	(void)key;
+	(void)bytecode;
+	return false;
+#endif // _WIN32
+}
+
+// Unmap cached bytecode.
+void unmapCache(Bytecode *bytecode) {
+#ifndef _WIN32
+	munmap(bytecode->mapping, bytecode->mappingSize);
+#endif // _WIN32
+	bytecode->bytes = NULL;
+	bytecode->mapping = NULL;
+}
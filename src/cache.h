@@ -0,0 +1,34 @@
+#ifndef BRAINIAC_CACHE_H
+#define BRAINIAC_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "compiler.h"
+#include "digest.h"
+
+// A key identifying cached bytecode by its source code.
+typedef struct {
+	// The source code's digest.
+	uint8_t digest[DIGEST_SIZE];
+	
+	// The source code's size in bytes.
+	uint64_t size;
+} CacheKey;
+
+// Initialize a cache key from source code and its size in bytes.
+void initCacheKey(CacheKey *key, const char *source, size_t size);
+
+// Map cached bytecode from a cache key and return whether valid bytecode was
+// cached.
+bool loadCache(const CacheKey *key, Bytecode *bytecode);
+
+// Store bytecode in the cache from a cache key and return whether it could be
+// stored.
+bool storeCache(const CacheKey *key, const Bytecode *bytecode);
+
+// Unmap cached bytecode.
+void unmapCache(Bytecode *bytecode);
+
+#endif // BRAINIAC_CACHE_H
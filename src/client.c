@@ -0,0 +1,394 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "cache.h"
+#include "client.h"
+#include "socket.h"
+#include "source.h"
+#include "stats.h"
+
+#ifndef _WIN32
+// A request to run a program on a server.
+typedef struct {
+	// The cache key of the program's source code.
+	CacheKey key;
+	
+	// The program's source code, or NULL to request the program by its cache
+	// key.
+	const char *source;
+	
+	// The maximum number of bytes to output, or 0 for no limit.
+	uint64_t outputLimit;
+	
+	// The maximum number of loop iterations, or 0 for no limit.
+	uint64_t fuel;
+	
+	// The request's input bytes.
+	const uint8_t *input;
+	
+	// The request's input size in bytes.
+	size_t inputSize;
+} ClientRequest;
+
+// A buffer for chunks of a response's output.
+typedef struct {
+	// The buffer's bytes.
+	uint8_t *bytes;
+	
+	// The buffer's capacity in bytes.
+	size_t capacity;
+} ChunkBuffer;
+
+// A load test shared by its worker threads.
+typedef struct {
+	// The server's socket path.
+	const char *socketPath;
+	
+	// The request to send repeatedly, by the cache key of its source code.
+	ClientRequest request;
+	
+	// The number of requests to send.
+	size_t requestCount;
+	
+	// The index of the next request to send.
+	size_t nextRequest;
+	
+	// The number of requests that failed.
+	size_t failedCount;
+	
+	// The latency of each request in nanoseconds.
+	uint64_t *latencies;
+	
+	// The lock for claiming requests and counting failures.
+	pthread_mutex_t lock;
+} LoadTest;
+
+// Get a message from a response status.
+static const char *getStatusMessage(ResponseStatus status) {
+	switch (status) {
+		case RESPONSE_OK: return "The program halted.";
+		case RESPONSE_UNKNOWN_HASH: return "The server has no program with the requested hash.";
+		case RESPONSE_COMPILE_ERROR: return "The server could not compile the program.";
+		case RESPONSE_OUTPUT_LIMIT: return "The program was stopped at its output limit.";
+		case RESPONSE_FUEL_LIMIT: return "The program was stopped at its loop iteration limit.";
+		default: return "The server rejected the request.";
+	}
+}
+
+// Send a request to a socket and return whether it was sent.
+static bool sendRequest(int socket, const ClientRequest *request) {
+	uint8_t header[9 + DIGEST_SIZE];
+	size_t headerSize;
+	
+	if (request->source != NULL) {
+		header[0] = REQUEST_SOURCE;
+		putSocketU64(header + 1, request->key.size);
+		headerSize = 9;
+	} else {
+		header[0] = REQUEST_HASH;
+		memcpy(header + 1, request->key.digest, DIGEST_SIZE);
+		putSocketU64(header + 1 + DIGEST_SIZE, request->key.size);
+		headerSize = sizeof(header);
+	}
+	
+	uint8_t footer[24];
+	putSocketU64(footer, request->outputLimit);
+	putSocketU64(footer + 8, request->fuel);
+	putSocketU64(footer + 16, request->inputSize);
+	
+	if (!sendSocket(socket, header, headerSize)) {
+		return false;
+	}
+	
+	if (request->source != NULL && !sendSocket(socket, request->source, (size_t)request->key.size)) {
+		return false;
+	}
+	
+	return sendSocket(socket, footer, sizeof(footer)) && sendSocket(socket, request->input, request->inputSize);
+}
+
+// Receive a response from a socket, writing its output to a file unless the
+// file is NULL, and return whether it was received. Fill a response status.
+static bool receiveResponse(int socket, ChunkBuffer *buffer, FILE *output, ResponseStatus *status) {
+	uint8_t header[4];
+	
+	for (;;) {
+		if (!receiveSocket(socket, header, sizeof(header))) {
+			return false;
+		}
+		
+		size_t size = (size_t)getSocketU32(header);
+		
+		if (size == 0) {
+			break;
+		}
+		
+		if (size > buffer->capacity) {
+			buffer->bytes = (uint8_t*)realloc(buffer->bytes, size);
+			buffer->capacity = size;
+			
+			if (buffer->bytes == NULL) {
+				exit(EXIT_FAILURE);
+			}
+		}
+		
+		if (!receiveSocket(socket, buffer->bytes, size)) {
+			return false;
+		}
+		
+		if (output != NULL) {
+			fwrite(buffer->bytes, sizeof(uint8_t), size, output);
+		}
+	}
+	
+	uint8_t trailer[RESPONSE_TRAILER_SIZE];
+	
+	if (!receiveSocket(socket, trailer, sizeof(trailer))) {
+		return false;
+	}
+	
+	*status = (ResponseStatus)trailer[0];
+	return true;
+}
+
+// Load a program's source code from a path and its input from standard input,
+// and initialize a request to run it. Return whether they could be loaded.
+static bool loadRequest(ClientRequest *request, Source *source, Source *input, const char *path, uint64_t outputLimit, uint64_t fuel) {
+	if (!loadSource(source, path)) {
+		return false;
+	}
+	
+	if (!readSource(input, stdin)) {
+		fprintf(stderr, "Encountered an error while reading standard input.\n");
+		freeSource(source);
+		return false;
+	}
+	
+	initCacheKey(&request->key, source->bytes, source->size);
+	request->source = source->bytes;
+	request->outputLimit = outputLimit;
+	request->fuel = fuel;
+	request->input = (const uint8_t*)input->bytes;
+	request->inputSize = input->size;
+	return true;
+}
+
+// Claim the index of the next request to send in a load test and return
+// whether there was one.
+static bool claimLoadRequest(LoadTest *test, size_t *index) {
+	pthread_mutex_lock(&test->lock);
+	bool isClaimed = test->nextRequest < test->requestCount;
+	
+	if (isClaimed) {
+		*index = test->nextRequest++;
+	}
+	
+	pthread_mutex_unlock(&test->lock);
+	return isClaimed;
+}
+
+// Send a load test's request on a connection, falling back to sending its
+// source code if the server does not have the program, and return whether the
+// program halted.
+static bool sendLoadRequest(LoadTest *test, int socket, ChunkBuffer *buffer) {
+	ClientRequest request = test->request;
+	const char *source = request.source;
+	request.source = NULL;
+	ResponseStatus status;
+	
+	if (!sendRequest(socket, &request) || !receiveResponse(socket, buffer, NULL, &status)) {
+		return false;
+	}
+	
+	if (status == RESPONSE_UNKNOWN_HASH) {
+		request.source = source;
+		
+		if (!sendRequest(socket, &request) || !receiveResponse(socket, buffer, NULL, &status)) {
+			return false;
+		}
+	}
+	
+	return status == RESPONSE_OK || status == RESPONSE_OUTPUT_LIMIT || status == RESPONSE_FUEL_LIMIT;
+}
+
+// Send requests from a load test on one connection until none are left,
+// reconnecting after failed requests.
+static void *runLoadWorker(void *argument) {
+	LoadTest *test = (LoadTest*)argument;
+	ChunkBuffer buffer = {NULL, 0};
+	int socket = -1;
+	size_t index;
+	
+	while (claimLoadRequest(test, &index)) {
+		uint64_t start = getClock();
+		
+		if (socket < 0) {
+			socket = connectSocket(test->socketPath);
+		}
+		
+		bool isSent = socket >= 0 && sendLoadRequest(test, socket, &buffer);
+		test->latencies[index] = getClock() - start;
+		
+		if (!isSent) {
+			if (socket >= 0) {
+				close(socket);
+				socket = -1;
+			}
+			
+			pthread_mutex_lock(&test->lock);
+			test->failedCount++;
+			pthread_mutex_unlock(&test->lock);
+		}
+	}
+	
+	if (socket >= 0) {
+		close(socket);
+	}
+	
+	free(buffer.bytes);
+	return NULL;
+}
+
+// Compare two latencies for sorting.
+static int compareLatencies(const void *a, const void *b) {
+	uint64_t left = *(const uint64_t*)a;
+	uint64_t right = *(const uint64_t*)b;
+	return (left > right) - (left < right);
+}
+
+// Get a latency percentile in milliseconds from sorted latencies.
+static double getPercentile(const uint64_t *latencies, size_t count, int percentile) {
+	size_t rank = (count * (size_t)percentile + 99) / 100;
+	return (double)latencies[rank > 0 ? rank - 1 : 0] / 1000000.0;
+}
+#endif // _WIN32
+
+// Run a program from a path on a server at a socket path with standard input
+// and output, stopping it after a number of output bytes or loop iterations,
+// or never if the number is 0. Return whether the program halted.
+bool runClient(const char *socketPath, const char *path, uint64_t outputLimit, uint64_t fuel) {
+#ifndef _WIN32
+	ClientRequest request;
+	Source source, input;
+	
+	if (!loadRequest(&request, &source, &input, path, outputLimit, fuel)) {
+		return false;
+	}
+	
+	int socket = connectSocket(socketPath);
+	ChunkBuffer buffer = {NULL, 0};
+	ResponseStatus status = RESPONSE_BAD_REQUEST;
+	bool isReceived = socket >= 0 && sendRequest(socket, &request) && receiveResponse(socket, &buffer, stdout, &status);
+	fflush(stdout);
+	freeSource(&input);
+	freeSource(&source);
+	free(buffer.bytes);
+	
+	if (socket < 0) {
+		fprintf(stderr, "Could not connect to '%s'.\n", socketPath);
+		return false;
+	} else if (!isReceived) {
+		close(socket);
+		fprintf(stderr, "Lost the connection to '%s'.\n", socketPath);
+		return false;
+	}
+	
+	close(socket);
+	
+	if (status != RESPONSE_OK) {
+		fprintf(stderr, "%s\n", getStatusMessage(status));
+		return false;
+	}
+	
+	return true;
+#else // _WIN32
+	(void)path;
+	(void)outputLimit;
+	(void)fuel;
+	fprintf(stderr, "Could not connect to '%s', sockets are not available on Windows.\n", socketPath);
+	return false;
+#endif // _WIN32
+}
+
+// Run a program from a path on a server at a socket path a number of times
+// with standard input, from a number of concurrent connections. Print the
+// requests' latency percentiles and throughput to standard error and return
+// whether every request succeeded.
+bool runLoadTest(const char *socketPath, const char *path, uint64_t outputLimit, uint64_t fuel, size_t requestCount, size_t threadCount) {
+#ifndef _WIN32
+	LoadTest test;
+	Source source, input;
+	
+	if (!loadRequest(&test.request, &source, &input, path, outputLimit, fuel)) {
+		return false;
+	}
+	
+	if (threadCount == 0) {
+		threadCount = 1;
+	}
+	
+	test.socketPath = socketPath;
+	test.requestCount = requestCount;
+	test.nextRequest = 0;
+	test.failedCount = 0;
+	test.latencies = (uint64_t*)malloc(requestCount * sizeof(uint64_t));
+	pthread_t *threads = (pthread_t*)malloc(threadCount * sizeof(pthread_t));
+	
+	if (test.latencies == NULL || threads == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	pthread_mutex_init(&test.lock, NULL);
+	uint64_t start = getClock();
+	size_t startedCount = 0;
+	
+	while (startedCount < threadCount && pthread_create(&threads[startedCount], NULL, runLoadWorker, &test) == 0) {
+		startedCount++;
+	}
+	
+	// Requests are still sent on the calling thread if no threads could be
+	// started.
+	if (startedCount == 0) {
+		runLoadWorker(&test);
+	}
+	
+	for (size_t i = 0; i < startedCount; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	
+	uint64_t time = getClock() - start;
+	pthread_mutex_destroy(&test.lock);
+	qsort(test.latencies, requestCount, sizeof(uint64_t), compareLatencies);
+	fprintf(stderr, "\nLoad test:\n");
+	fprintf(stderr, "%-24s %16zu\n", "Requests", requestCount);
+	fprintf(stderr, "%-24s %16zu\n", "Failed requests", test.failedCount);
+	fprintf(stderr, "%-24s %16zu\n", "Connections", threadCount);
+	fprintf(stderr, "%-24s %16.3f ms\n", "Total", (double)time / 1000000.0);
+	fprintf(stderr, "%-24s %16.1f requests/s\n", "Throughput", time > 0 ? (double)requestCount * 1000000000.0 / (double)time : 0.0);
+	fprintf(stderr, "%-24s %16.3f ms\n", "p50 latency", getPercentile(test.latencies, requestCount, 50));
+	fprintf(stderr, "%-24s %16.3f ms\n", "p90 latency", getPercentile(test.latencies, requestCount, 90));
+	fprintf(stderr, "%-24s %16.3f ms\n", "p99 latency", getPercentile(test.latencies, requestCount, 99));
+	fprintf(stderr, "%-24s %16.3f ms\n", "Maximum latency", getPercentile(test.latencies, requestCount, 100));
+	free(threads);
+	free(test.latencies);
+	freeSource(&input);
+	freeSource(&source);
+	return test.failedCount == 0;
+#else // _WIN32
+	(void)path;
+	(void)outputLimit;
+	(void)fuel;
+	(void)requestCount;
+	(void)threadCount;
+	fprintf(stderr, "Could not connect to '%s', sockets are not available on Windows.\n", socketPath);
+	return false;
+#endif // _WIN32
+}
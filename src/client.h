@@ -0,0 +1,19 @@
+#ifndef BRAINIAC_CLIENT_H
+#define BRAINIAC_CLIENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Run a program from a path on a server at a socket path with standard input
+// and output, stopping it after a number of output bytes or loop iterations,
+// or never if the number is 0. Return whether the program halted.
+bool runClient(const char *socketPath, const char *path, uint64_t outputLimit, uint64_t fuel);
+
+// Run a program from a path on a server at a socket path a number of times
+// with standard input, from a number of concurrent connections. Print the
+// requests' latency percentiles and throughput to standard error and return
+// whether every request succeeded.
+bool runLoadTest(const char *socketPath, const char *path, uint64_t outputLimit, uint64_t fuel, size_t requestCount, size_t threadCount);
+
+#endif // BRAINIAC_CLIENT_H
@@ -1,5 +1,8 @@
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "cache.h"
 #include "compiler.h"
 #ifdef BRAINIAC_DEBUG
 #include "debug.h"
@@ -8,57 +11,224 @@
 #include "optimizer.h"
 #include "parser.h"
 #include "scanner.h"
+#include "source.h"
 
-// Compile bytecode from a scanner.
-static uint8_t *compileScanner(Scanner *scanner) {
+// Parse and optimize a program from a scanner and record optional statistics.
+// Return NULL if the program has syntax errors or memory could not be
+// allocated.
+static Node *optimizeScanner(Scanner *scanner, Stats *stats) {
+	uint64_t start = getClock();
 	Node *program = parseScanner(scanner);
 	
 	if (program == NULL) {
 		return NULL;
 	}
+	
+	if (stats != NULL) {
+		stats->phaseTimes[PHASE_PARSE] = getClock() - start;
+		stats->parsedNodeCount = countNodes(program);
+	}
 #ifdef BRAINIAC_DEBUG
 	printf("Parsed AST:\n");
 	printProgram(program);
 #endif // BRAINIAC_DEBUG
-	optimizeProgram(program);
-	uint8_t *bytecode = compileProgram(program);
+	start = getClock();
+	int passCount = optimizeProgram(program);
+	
+	if (passCount < 0) {
+		freeProgram(program);
+		return NULL;
+	}
+	
+	if (stats != NULL) {
+		stats->phaseTimes[PHASE_OPTIMIZE] = getClock() - start;
+		stats->optimizedNodeCount = countNodes(program);
+		stats->passCount = passCount;
+	}
 #ifdef BRAINIAC_DEBUG
 	printf("\nOptimized AST:\n");
 	printProgram(program);
+#endif // BRAINIAC_DEBUG
+	return program;
+}
+
+// Compile bytecode from an optional program, fill an optional loop table with
+// its loops, and record optional statistics. Return whether the bytecode was
+// compiled.
+static bool compileOptionalProgram(Node *program, Bytecode *bytecode, LoopTable *loops, Stats *stats) {
+	if (program == NULL) {
+		return false;
+	}
+	
+	uint64_t start = getClock();
+	bytecode->bytes = compileProgram(program, &bytecode->size, loops);
+	
+	if (bytecode->bytes == NULL) {
+		freeProgram(program);
+		return false;
+	}
+	
+	bytecode->mapping = NULL;
+	bytecode->mappingSize = 0;
+	
+	if (stats != NULL) {
+		stats->phaseTimes[PHASE_GENERATE] = getClock() - start;
+		stats->bytecodeSize = bytecode->size;
+	}
+#ifdef BRAINIAC_DEBUG
 	printf("\nCompiled bytecode:\n");
-	printBytecode(bytecode);
+	printBytecode(bytecode->bytes);
 	printf("\n");
 #endif // BRAINIAC_DEBUG
-	freeNode(program);
-	return bytecode;
+	freeProgram(program);
+	return true;
+}
+
+// Parse and optimize a program from source code and its size in bytes.
+static Node *optimizeBytes(const char *source, size_t size) {
+	Scanner scanner;
+	initScanner(&scanner, source, size);
+	return optimizeScanner(&scanner, NULL);
 }
 
-// Compile bytecode from a path.
-uint8_t *compilePath(const char *path) {
-	FILE *file = fopen(path, "rb");
+// Parse and optimize a program from a path.
+Node *optimizePath(const char *path) {
+	Source source;
 	
-	if (file == NULL) {
-		fprintf(stderr, "Could not open '%s', file may not exist.\n", path);
+	if (!loadSource(&source, path)) {
 		return NULL;
 	}
 	
+	Node *program = optimizeBytes(source.bytes, source.size);
+	freeSource(&source);
+	return program;
+}
+
+// Parse and optimize a program from source code.
+Node *optimizeSource(const char *source) {
+	return optimizeBytes(source, strlen(source));
+}
+
+// Compile bytecode from a path, or map it from the cache if it was cached.
+// Return whether the bytecode was compiled.
+bool compilePath(const char *path, Bytecode *bytecode) {
+	Source source;
+	
+	if (!loadSource(&source, path)) {
+		return false;
+	}
+	
+	CacheKey key;
+	initCacheKey(&key, source.bytes, source.size);
+	
+	if (loadCache(&key, bytecode)) {
+		freeSource(&source);
+#ifdef BRAINIAC_DEBUG
+		printf("Mapped cached bytecode:\n");
+		printBytecode(bytecode->bytes);
+		printf("\n");
+#endif // BRAINIAC_DEBUG
+		return true;
+	}
+	
+	Node *program = optimizeBytes(source.bytes, source.size);
+	freeSource(&source);
+	return compileOptionalProgram(program, bytecode, NULL, NULL);
+}
+
+// Compile bytecode from source code and return whether it was compiled.
+bool compileSource(const char *source, Bytecode *bytecode) {
+	return compileOptionalProgram(optimizeSource(source), bytecode, NULL, NULL);
+}
+
+// Compile bytecode from source code and its size in bytes and return whether
+// it was compiled.
+bool compileSourceBytes(const char *source, size_t size, Bytecode *bytecode) {
+	return compileOptionalProgram(optimizeBytes(source, size), bytecode, NULL, NULL);
+}
+
+// Compile bytecode from a path without the cache and fill a loop table with its
+// loops and their line and column numbers. Return whether the bytecode was
+// compiled.
+bool compileProfiledPath(const char *path, Bytecode *bytecode, LoopTable *loops) {
+	Source source;
+	
+	if (!loadSource(&source, path)) {
+		return false;
+	}
+	
 	Scanner scanner;
-	initScannerFile(&scanner, file);
-	uint8_t *bytecode = compileScanner(&scanner);
+	initScanner(&scanner, source.bytes, source.size);
 	
-	if (ferror(file) || !feof(file)) {
-		fprintf(stderr, "Encountered an error while reading '%s'.\n", path);
-		free(bytecode);
-		bytecode = NULL;
+	if (!compileOptionalProgram(optimizeScanner(&scanner, NULL), bytecode, loops, NULL)) {
+		freeSource(&source);
+		return false;
 	}
 	
-	fclose(file);
-	return bytecode;
+	for (int i = 0; i < loops->count; i++) {
+		LoopPosition *loop = &loops->loops[i];
+		getScannerPosition(&scanner, source.bytes + loop->position, &loop->line, &loop->column);
+	}
+	
+	freeSource(&source);
+	return true;
 }
 
-// Compile bytecode from source code.
-uint8_t *compileSource(const char *source) {
+// Compile bytecode from a path without the cache and record statistics about
+// loading, parsing, optimizing, and generating it. Return whether the bytecode
+// was compiled.
+bool compileMeasuredPath(const char *path, Bytecode *bytecode, Stats *stats) {
+	uint64_t start = getClock();
+	Source source;
+	
+	if (!loadSource(&source, path)) {
+		return false;
+	}
+	
+	stats->phaseTimes[PHASE_LOAD] = getClock() - start;
+	stats->sourceSize = source.size;
 	Scanner scanner;
-	initScannerSource(&scanner, source);
-	return compileScanner(&scanner);
+	initScanner(&scanner, source.bytes, source.size);
+	Node *program = optimizeScanner(&scanner, stats);
+	freeSource(&source);
+	return compileOptionalProgram(program, bytecode, NULL, stats);
+}
+
+// Compile bytecode from a path and store it in the cache. Return whether the
+// bytecode was stored.
+bool cachePath(const char *path) {
+	Source source;
+	
+	if (!loadSource(&source, path)) {
+		return false;
+	}
+	
+	CacheKey key;
+	initCacheKey(&key, source.bytes, source.size);
+	Node *program = optimizeBytes(source.bytes, source.size);
+	freeSource(&source);
+	Bytecode bytecode;
+	
+	if (!compileOptionalProgram(program, &bytecode, NULL, NULL)) {
+		return false;
+	}
+	
+	bool isStored = storeCache(&key, &bytecode);
+	freeBytecode(&bytecode);
+	
+	if (!isStored) {
+		fprintf(stderr, "Could not store bytecode for '%s' in the cache.\n", path);
+	}
+	
+	return isStored;
+}
+
+// Free bytecode.
+void freeBytecode(Bytecode *bytecode) {
+	if (bytecode->mapping != NULL) {
+		unmapCache(bytecode);
+	} else {
+		free(bytecode->bytes);
+		bytecode->bytes = NULL;
+	}
 }
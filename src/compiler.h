@@ -1,12 +1,62 @@
 #ifndef BRAINIAC_COMPILER_H
 #define BRAINIAC_COMPILER_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
-// Compile bytecode from a path.
-uint8_t *compilePath(const char *path);
+#include "generator.h"
+#include "node.h"
+#include "stats.h"
 
-// Compile bytecode from source code.
-uint8_t *compileSource(const char *source);
+// Compiled bytecode.
+typedef struct {
+	// The bytecode's bytes.
+	uint8_t *bytes;
+	
+	// The bytecode's size in bytes.
+	size_t size;
+	
+	// The mapped cached image containing the bytecode, or NULL if the bytecode
+	// was compiled.
+	void *mapping;
+	
+	// The size of the mapped cached image in bytes.
+	size_t mappingSize;
+} Bytecode;
+
+// Parse and optimize a program from a path.
+Node *optimizePath(const char *path);
+
+// Parse and optimize a program from source code.
+Node *optimizeSource(const char *source);
+
+// Compile bytecode from a path, or map it from the cache if it was cached.
+// Return whether the bytecode was compiled.
+bool compilePath(const char *path, Bytecode *bytecode);
+
+// Compile bytecode from source code and return whether it was compiled.
+bool compileSource(const char *source, Bytecode *bytecode);
+
+// Compile bytecode from source code and its size in bytes and return whether
+// it was compiled.
+bool compileSourceBytes(const char *source, size_t size, Bytecode *bytecode);
+
+// Compile bytecode from a path without the cache and fill a loop table with its
+// loops and their line and column numbers. Return whether the bytecode was
+// compiled.
+bool compileProfiledPath(const char *path, Bytecode *bytecode, LoopTable *loops);
+
+// Compile bytecode from a path without the cache and record statistics about
+// loading, parsing, optimizing, and generating it. Return whether the bytecode
+// was compiled.
+bool compileMeasuredPath(const char *path, Bytecode *bytecode, Stats *stats);
+
+// Compile bytecode from a path and store it in the cache. Return whether the
+// bytecode was stored.
+bool cachePath(const char *path);
+
+// Free bytecode.
+void freeBytecode(Bytecode *bytecode);
 
 #endif // BRAINIAC_COMPILER_H
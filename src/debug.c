@@ -53,6 +53,10 @@ static const char *getNodeKindName(NodeKind kind) {
 		case NODE_OUTPUT: return "OUTPUT";
 		case NODE_INPUT: return "INPUT";
 		case NODE_SET: return "SET";
+		case NODE_MUL: return "MUL";
+		case NODE_SCAN: return "SCAN";
+		case NODE_REPEAT: return "REPEAT";
+		case NODE_WRITE: return "WRITE";
 	}
 	
 	return "UNKNOWN";
@@ -64,6 +68,10 @@ static bool nodeKindHasValue(NodeKind kind) {
 		case NODE_MOVE:
 		case NODE_ADD:
 		case NODE_SET:
+		case NODE_MUL:
+		case NODE_SCAN:
+		case NODE_REPEAT:
+		case NODE_WRITE:
 			return true;
 		default:
 			return false;
@@ -94,6 +102,10 @@ static void printNode(Node *node, Indent *indent) {
 		printf(": %d", node->value);
 	}
 	
+	if (node->offset != 0) {
+		printf(" @ %+d", node->offset);
+	}
+	
 	printf(")\n");
 	
 	for (int i = 0; i < node->childCount; i++) {
@@ -123,28 +135,72 @@ static uint16_t fetchU16(uint8_t *bytecode, int *offset) {
 	return (uint16_t)((highByte << 8) | lowByte);
 }
 
-// Print a basic operation.
-static void printBasicOp(const char *name) {
-	printf("%s\n", name);
-}
-
-// Print a U8 operation.
-static void printU8Op(const char *name, uint8_t *bytecode, int *offset) {
-	printf("%s %d\n", name, fetchU8(bytecode, offset));
+// Fetch a U32 value from bytecode.
+static uint32_t fetchU32(uint8_t *bytecode, int *offset) {
+	uint16_t lowHalf = fetchU16(bytecode, offset);
+	uint16_t highHalf = fetchU16(bytecode, offset);
+	return (uint32_t)highHalf << 16 | lowHalf;
 }
 
-// Print a U16 operation.
-static void printU16Op(const char *name, uint8_t *bytecode, int *offset) {
-	printf("%s %d\n", name, fetchU16(bytecode, offset));
-}
-
-// Print a jump operation.
-static void printJumpOp(const char *name, uint8_t *bytecode, int *offset, int size, int sign) {
-	int32_t jump = (int32_t)(size == 16 ? fetchU16(bytecode, offset) : fetchU8(bytecode, offset));
-	printf("%s %d ; -> @%04d\n", name, jump, *offset + sign * jump);
+// Print an opcode's operands.
+static void printOperands(Operands operands, uint8_t *bytecode, int *offset) {
+	switch (operands) {
+		case OPERANDS_NONE:
+			break;
+		case OPERANDS_U8:
+			printf(" %d", fetchU8(bytecode, offset));
+			break;
+		case OPERANDS_U16:
+			printf(" %d", fetchU16(bytecode, offset));
+			break;
+		case OPERANDS_S16:
+			printf(" %+d", (int16_t)fetchU16(bytecode, offset));
+			break;
+		case OPERANDS_S16_U8:
+			printf(" %+d", (int16_t)fetchU16(bytecode, offset));
+			printf(" %d", fetchU8(bytecode, offset));
+			break;
+		case OPERANDS_BRZ_U8: {
+			int jump = fetchU8(bytecode, offset);
+			printf(" %d ; -> @%04d", jump, *offset + jump);
+			break;
+		}
+		case OPERANDS_BRZ_U16: {
+			int jump = fetchU16(bytecode, offset);
+			printf(" %d ; -> @%04d", jump, *offset + jump);
+			break;
+		}
+		case OPERANDS_BRZ_U32: {
+			uint32_t jump = fetchU32(bytecode, offset);
+			printf(" %u ; -> @%04d", jump, *offset + (int)jump);
+			break;
+		}
+		case OPERANDS_BNZ_U8: {
+			int jump = fetchU8(bytecode, offset);
+			printf(" %d ; -> @%04d", jump, *offset - jump);
+			break;
+		}
+		case OPERANDS_BNZ_U16: {
+			int jump = fetchU16(bytecode, offset);
+			printf(" %d ; -> @%04d", jump, *offset - jump);
+			break;
+		}
+		case OPERANDS_BNZ_U32: {
+			uint32_t jump = fetchU32(bytecode, offset);
+			printf(" %u ; -> @%04d", jump, *offset - (int)jump);
+			break;
+		}
+		case OPERANDS_DATA: {
+			uint32_t dataOffset = fetchU32(bytecode, offset);
+			int address = *offset + (int)dataOffset;
+			printf(" %u %u ; -> @%04d", dataOffset, fetchU32(bytecode, offset), address);
+			break;
+		}
+	}
 }
 
-// Print bytecode.
+// Print bytecode. Superinstructions are printed with their sequence's
+// operands in order.
 void printBytecode(uint8_t *bytecode) {
 	int offset = 0;
 	Opcode opcode;
@@ -152,28 +208,13 @@ void printBytecode(uint8_t *bytecode) {
 	do {
 		printf("@%04d | ", offset);
 		opcode = (Opcode)fetchU8(bytecode, &offset);
+		const OpcodeInfo *info = getOpcodeInfo(opcode);
+		printf("%s", info->name);
 		
-		switch (opcode) {
-			case OP_HLT: printBasicOp("HLT"); break;
-			case OP_RGT: printBasicOp("RGT"); break;
-			case OP_RGT_U8: printU8Op("RGT_U8", bytecode, &offset); break;
-			case OP_RGT_U16: printU16Op("RGT_U16", bytecode, &offset); break;
-			case OP_LFT: printBasicOp("LFT"); break;
-			case OP_LFT_U8: printU8Op("LFT_U8", bytecode, &offset); break;
-			case OP_LFT_U16: printU16Op("LFT_U16", bytecode, &offset); break;
-			case OP_INC: printBasicOp("INC"); break;
-			case OP_INC_U8: printU8Op("INC_U8", bytecode, &offset); break;
-			case OP_DEC: printBasicOp("DEC"); break;
-			case OP_DEC_U8: printU8Op("DEC_U8", bytecode, &offset); break;
-			case OP_OUT: printBasicOp("OUT"); break;
-			case OP_INP: printBasicOp("INP"); break;
-			case OP_BRZ_U8: printJumpOp("BRZ_U8", bytecode, &offset, 8, 1); break;
-			case OP_BRZ_U16: printJumpOp("BRZ_U16", bytecode, &offset, 16, 1); break;
-			case OP_BNZ_U8: printJumpOp("BNZ_U8", bytecode, &offset, 8, -1); break;
-			case OP_BNZ_U16: printJumpOp("BNZ_U16", bytecode, &offset, 16, -1); break;
-			case OP_SET_0: printBasicOp("SET_0"); break;
-			case OP_SET_1: printBasicOp("SET_1"); break;
-			case OP_SET_U8: printU8Op("SET_U8", bytecode, &offset); break;
+		for (int i = 0; i < info->length; i++) {
+			printOperands(getOpcodeInfo(info->sequence[i])->operands, bytecode, &offset);
 		}
+		
+		printf("\n");
 	} while (opcode != OP_HLT);
 }
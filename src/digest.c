@@ -0,0 +1,120 @@
+#include <string.h>
+
+#include "digest.h"
+
+// The size of a SHA-256 block in bytes.
+#define DIGEST_BLOCK_SIZE 64
+
+// Rotate a U32 value right by a number of bits.
+#define DIGEST_ROTATE(value, bits) (((value) >> (bits)) | ((value) << (32 - (bits))))
+
+// Perform a SHA-256 round with working variables, adding to d and h.
+#define DIGEST_ROUND(a, b, c, d, e, f, g, h, i) do { \
+	uint32_t first = (h) + (DIGEST_ROTATE(e, 6) ^ DIGEST_ROTATE(e, 11) ^ DIGEST_ROTATE(e, 25)) \
+		+ (((e) & (f)) ^ (~(e) & (g))) + roundConstants[i] + words[i]; \
+	uint32_t second = (DIGEST_ROTATE(a, 2) ^ DIGEST_ROTATE(a, 13) ^ DIGEST_ROTATE(a, 22)) \
+		+ (((a) & (b)) ^ ((a) & (c)) ^ ((b) & (c))); \
+	(d) += first; \
+	(h) = first + second; \
+} while (0)
+
+// The SHA-256 round constants.
+static const uint32_t roundConstants[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// Update a SHA-256 state with a block.
+static void hashBlock(uint32_t *state, const uint8_t *block) {
+	uint32_t words[64];
+	
+	for (int i = 0; i < 16; i++) {
+		const uint8_t *bytes = block + i * 4;
+		words[i] = (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 | (uint32_t)bytes[2] << 8 | bytes[3];
+	}
+	
+	for (int i = 16; i < 64; i++) {
+		uint32_t low = DIGEST_ROTATE(words[i - 15], 7) ^ DIGEST_ROTATE(words[i - 15], 18) ^ (words[i - 15] >> 3);
+		uint32_t high = DIGEST_ROTATE(words[i - 2], 17) ^ DIGEST_ROTATE(words[i - 2], 19) ^ (words[i - 2] >> 10);
+		words[i] = words[i - 16] + low + words[i - 7] + high;
+	}
+	
+	uint32_t a = state[0];
+	uint32_t b = state[1];
+	uint32_t c = state[2];
+	uint32_t d = state[3];
+	uint32_t e = state[4];
+	uint32_t f = state[5];
+	uint32_t g = state[6];
+	uint32_t h = state[7];
+	
+	// Rounds are unrolled by 8 so that the working variables rotate by renaming
+	// instead of being moved after each round.
+	for (int i = 0; i < 64; i += 8) {
+		DIGEST_ROUND(a, b, c, d, e, f, g, h, i);
+		DIGEST_ROUND(h, a, b, c, d, e, f, g, i + 1);
+		DIGEST_ROUND(g, h, a, b, c, d, e, f, i + 2);
+		DIGEST_ROUND(f, g, h, a, b, c, d, e, i + 3);
+		DIGEST_ROUND(e, f, g, h, a, b, c, d, i + 4);
+		DIGEST_ROUND(d, e, f, g, h, a, b, c, i + 5);
+		DIGEST_ROUND(c, d, e, f, g, h, a, b, i + 6);
+		DIGEST_ROUND(b, c, d, e, f, g, h, a, i + 7);
+	}
+	
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+	state[5] += f;
+	state[6] += g;
+	state[7] += h;
+}
+
+// Get the SHA-256 digest of a number of bytes.
+void getDigest(uint8_t *digest, const void *bytes, size_t count) {
+	uint32_t state[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+	};
+	
+	const uint8_t *next = (const uint8_t*)bytes;
+	size_t index = 0;
+	
+	for (; count - index >= DIGEST_BLOCK_SIZE; index += DIGEST_BLOCK_SIZE) {
+		hashBlock(state, next + index);
+	}
+	
+	// The remaining bytes are followed by a 1 bit, zero padding, and the
+	// message's size in bits, which may take one or two more blocks.
+	uint8_t tail[DIGEST_BLOCK_SIZE * 2] = {0};
+	size_t remaining = count - index;
+	
+	if (remaining > 0) {
+		memcpy(tail, next + index, remaining);
+	}
+	
+	tail[remaining] = 0x80;
+	size_t tailSize = remaining < DIGEST_BLOCK_SIZE - 8 ? DIGEST_BLOCK_SIZE : DIGEST_BLOCK_SIZE * 2;
+	uint64_t bitCount = (uint64_t)count * 8;
+	
+	for (int i = 0; i < 8; i++) {
+		tail[tailSize - 1 - i] = (uint8_t)(bitCount >> (i * 8));
+	}
+	
+	for (size_t i = 0; i < tailSize; i += DIGEST_BLOCK_SIZE) {
+		hashBlock(state, tail + i);
+	}
+	
+	for (int i = 0; i < 8; i++) {
+		digest[i * 4] = (uint8_t)(state[i] >> 24);
+		digest[i * 4 + 1] = (uint8_t)(state[i] >> 16);
+		digest[i * 4 + 2] = (uint8_t)(state[i] >> 8);
+		digest[i * 4 + 3] = (uint8_t)state[i];
+	}
+}
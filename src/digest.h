@@ -0,0 +1,13 @@
+#ifndef BRAINIAC_DIGEST_H
+#define BRAINIAC_DIGEST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The size of a digest in bytes.
+#define DIGEST_SIZE 32
+
+// Get the SHA-256 digest of a number of bytes.
+void getDigest(uint8_t *digest, const void *bytes, size_t count);
+
+#endif // BRAINIAC_DIGEST_H
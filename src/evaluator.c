@@ -0,0 +1,285 @@
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "evaluator.h"
+
+// The number of memory cells that can be evaluated. Bounded tapes have at
+// least one 4 KiB page of cells and wrapping tapes have more, so memory
+// accesses in this range behave the same on every tape.
+#define EVALUATOR_CELLS 4096
+
+// The maximum number of nodes to evaluate.
+#define EVALUATOR_BUDGET 1000000
+
+// The maximum number of output bytes to evaluate.
+#define EVALUATOR_OUTPUT_LIMIT (1 << 20)
+
+// The state of evaluating a program.
+typedef struct {
+	// The evaluated memory.
+	uint8_t memory[EVALUATOR_CELLS];
+	
+	// The evaluated memory pointer.
+	int pointer;
+	
+	// The number of nodes that can still be evaluated.
+	long budget;
+	
+	// The number of output bytes.
+	int outputCount;
+	
+	// The output byte capacity.
+	int outputCapacity;
+	
+	// The output bytes.
+	uint8_t *output;
+} Evaluator;
+
+// Output a byte from an evaluator and return whether it could be evaluated.
+static bool evaluateOutput(Evaluator *evaluator, uint8_t value) {
+	if (evaluator->outputCount == EVALUATOR_OUTPUT_LIMIT) {
+		return false;
+	}
+	
+	// Output that cannot be allocated is not evaluated.
+	if (evaluator->outputCount == evaluator->outputCapacity) {
+		int capacity = evaluator->outputCapacity != 0 ? evaluator->outputCapacity * 2 : 64;
+		uint8_t *output = (uint8_t*)realloc(evaluator->output, capacity * sizeof(uint8_t));
+		
+		if (output == NULL) {
+			return false;
+		}
+		
+		evaluator->outputCapacity = capacity;
+		evaluator->output = output;
+	}
+	
+	evaluator->output[evaluator->outputCount++] = value;
+	return true;
+}
+
+// Get a pointer to evaluated memory at an offset, or NULL if the memory cannot
+// be evaluated.
+static uint8_t *getCell(Evaluator *evaluator, int offset) {
+	int index = evaluator->pointer + offset;
+	
+	if (index < 0 || index >= EVALUATOR_CELLS) {
+		return NULL;
+	}
+	
+	return &evaluator->memory[index];
+}
+
+// Evaluate a node and return whether it could be evaluated.
+static bool evaluateNode(Evaluator *evaluator, Node *node);
+
+// Evaluate a node's children and return whether they could be evaluated.
+static bool evaluateChildren(Evaluator *evaluator, Node *node) {
+	for (int i = 0; i < node->childCount; i++) {
+		if (!evaluateNode(evaluator, node->children[i])) {
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+// Evaluate a node and return whether it could be evaluated.
+static bool evaluateNode(Evaluator *evaluator, Node *node) {
+	if (--evaluator->budget < 0) {
+		return false;
+	}
+	
+	uint8_t *cell = getCell(evaluator, node->kind == NODE_MUL ? 0 : node->offset);
+	
+	if (cell == NULL) {
+		return false;
+	}
+	
+	switch (node->kind) {
+		case NODE_PROGRAM:
+			return evaluateChildren(evaluator, node);
+		case NODE_LOOP:
+			while (*cell != 0) {
+				if (!evaluateChildren(evaluator, node)) {
+					return false;
+				}
+				
+				cell = getCell(evaluator, 0);
+				
+				if (cell == NULL || --evaluator->budget < 0) {
+					return false;
+				}
+			}
+			
+			return true;
+		case NODE_MOVE:
+			if (getCell(evaluator, node->value) == NULL) {
+				return false;
+			}
+			
+			evaluator->pointer += node->value;
+			return true;
+		case NODE_ADD:
+			*cell += (uint8_t)node->value;
+			return true;
+		case NODE_OUTPUT:
+			return evaluateOutput(evaluator, *cell);
+		case NODE_INPUT:
+			return false;
+		case NODE_SET:
+			*cell = (uint8_t)node->value;
+			return true;
+		case NODE_MUL: {
+			uint8_t *target = getCell(evaluator, node->offset);
+			
+			if (target == NULL) {
+				return false;
+			}
+			
+			*target += (uint8_t)(*cell * node->value);
+			return true;
+		}
+		case NODE_SCAN:
+			while (*cell != 0) {
+				cell = getCell(evaluator, node->value);
+				
+				if (cell == NULL || --evaluator->budget < 0) {
+					return false;
+				}
+				
+				evaluator->pointer += node->value;
+			}
+			
+			return true;
+		case NODE_REPEAT: {
+			uint8_t count = (uint8_t)(*cell * node->value);
+			*cell = 0;
+			
+			for (int i = 0; i < count; i++) {
+				if (!evaluateChildren(evaluator, node)) {
+					return false;
+				}
+			}
+			
+			return true;
+		}
+		case NODE_WRITE:
+			for (int i = 0; i < node->value; i++) {
+				if (!evaluateOutput(evaluator, node->data[i])) {
+					return false;
+				}
+			}
+			
+			return true;
+	}
+	
+	return false;
+}
+
+// Replace the evaluated nodes at the start of a program with their output,
+// nodes that set non-zero memory, and a move to the memory pointer. Return
+// whether memory could be allocated.
+static bool replaceProgramHead(Node *program, const Evaluator *evaluator, int headCount) {
+	Arena *arena = program->arena;
+	jmp_buf recovery;
+	jmp_buf *previous = setArenaRecovery(arena, &recovery);
+	
+	if (setjmp(recovery) != 0) {
+		setArenaRecovery(arena, previous);
+		return false;
+	}
+	
+	Node *head = newNode(arena, NODE_PROGRAM, 0);
+	
+	if (evaluator->outputCount > 0) {
+		Node *write = newNode(arena, NODE_WRITE, 0);
+		setNodeData(write, evaluator->output, evaluator->outputCount);
+		appendNode(head, write);
+	}
+	
+	for (int i = 0; i < EVALUATOR_CELLS; i++) {
+		if (evaluator->memory[i] != 0) {
+			Node *set = newNode(arena, NODE_SET, evaluator->memory[i]);
+			set->offset = i;
+			appendNode(head, set);
+		}
+	}
+	
+	if (evaluator->pointer != 0) {
+		appendNode(head, newNode(arena, NODE_MOVE, evaluator->pointer));
+	}
+	
+	for (int i = headCount; i < program->childCount; i++) {
+		appendNode(head, program->children[i]);
+	}
+	
+	program->children = head->children;
+	program->childCount = head->childCount;
+	program->childCapacity = head->childCapacity;
+	setArenaRecovery(arena, previous);
+	return true;
+}
+
+// Evaluate the start of a program that does not depend on input and replace it
+// with its output and final memory. Return whether the program was changed.
+// Programs are left unchanged if memory cannot be allocated for evaluating
+// them.
+bool evaluateProgramHead(Node *program) {
+	Evaluator *evaluator = (Evaluator*)calloc(1, sizeof(Evaluator));
+	uint8_t *memory = (uint8_t*)malloc(EVALUATOR_CELLS * sizeof(uint8_t));
+	
+	if (evaluator == NULL || memory == NULL) {
+		free(evaluator);
+		free(memory);
+		return false;
+	}
+	
+	evaluator->budget = EVALUATOR_BUDGET;
+	int headCount = 0;
+	
+	// Memory, the memory pointer, and output are restored from before a child
+	// node that could not be fully evaluated. Only loops can change memory
+	// before failing, so memory is only saved before loops.
+	for (; headCount < program->childCount; headCount++) {
+		Node *child = program->children[headCount];
+		bool isLoop = child->kind == NODE_LOOP || child->kind == NODE_REPEAT;
+		int pointer = evaluator->pointer;
+		int outputCount = evaluator->outputCount;
+		
+		if (isLoop) {
+			memcpy(memory, evaluator->memory, EVALUATOR_CELLS);
+		}
+		
+		if (!evaluateNode(evaluator, child)) {
+			if (isLoop) {
+				memcpy(evaluator->memory, memory, EVALUATOR_CELLS);
+			}
+			
+			evaluator->pointer = pointer;
+			evaluator->outputCount = outputCount;
+			break;
+		}
+	}
+	
+	free(memory);
+	
+	if (headCount == 0) {
+		free(evaluator->output);
+		free(evaluator);
+		return false;
+	}
+	
+	bool isReplaced = replaceProgramHead(program, evaluator, headCount);
+	free(evaluator->output);
+	free(evaluator);
+	
+	if (!isReplaced) {
+		failArena(program->arena);
+	}
+	
+	return true;
+}
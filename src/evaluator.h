@@ -0,0 +1,12 @@
+#ifndef BRAINIAC_EVALUATOR_H
+#define BRAINIAC_EVALUATOR_H
+
+#include <stdbool.h>
+
+#include "node.h"
+
+// Evaluate the start of a program that does not depend on input and replace it
+// with its output and final memory. Return whether the program was changed.
+bool evaluateProgramHead(Node *program);
+
+#endif // BRAINIAC_EVALUATOR_H
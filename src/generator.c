@@ -1,11 +1,27 @@
-#include <stdio.h>
+#include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "generator.h"
 #include "opcode.h"
 
-// A buffer of bytes.
+// A branch in bytecode with placeholder branch operands.
 typedef struct {
+	// The branch's opcode's address.
+	int address;
+	
+	// The branch's target address.
+	int target;
+	
+	// The number of branches before the branch's target address.
+	int targetIndex;
+	
+	// The size of the branch's branch operand in bytes.
+	int operandSize;
+} Branch;
+
+// A buffer of bytes.
+typedef struct Buffer {
 	// The number of bytes in the buffer.
 	int count;
 	
@@ -14,27 +30,81 @@ typedef struct {
 	
 	// The buffer's bytes.
 	uint8_t *bytes;
+	
+	// The buffer of literal data for bytecode in the buffer, or NULL if the
+	// buffer is for literal data.
+	struct Buffer *literals;
+	
+	// The number of branches with placeholder branch operands in the buffer.
+	int branchCount;
+	
+	// The buffer's branch capacity.
+	int branchCapacity;
+	
+	// The branches with placeholder branch operands in the buffer by address.
+	Branch *branches;
+	
+	// The table of loops in the buffer, or NULL if loops are not recorded.
+	LoopTable *loops;
+	
+	// Whether memory could not be allocated for the buffer. Failed buffers
+	// stop growing and are discarded instead of being compiled.
+	bool isFailed;
 } Buffer;
 
-// Initialize a buffer.
-static void initBuffer(Buffer *buffer) {
+// Initialize a buffer from its buffer of literal data.
+static void initBuffer(Buffer *buffer, Buffer *literals) {
 	buffer->count = 0;
 	buffer->capacity = 0;
 	buffer->bytes = NULL;
+	buffer->literals = literals;
+	buffer->branchCount = 0;
+	buffer->branchCapacity = 0;
+	buffer->branches = NULL;
+	buffer->loops = NULL;
+	buffer->isFailed = false;
+}
+
+// Reserve space for a number of bytes in a buffer and return whether the
+// space could be allocated.
+static bool reserveBuffer(Buffer *buffer, int count) {
+	if (buffer->count + count <= buffer->capacity) {
+		return true;
+	}
+	
+	int capacity = buffer->capacity != 0 ? buffer->capacity * 2 : 8;
+	
+	while (buffer->count + count > capacity) {
+		capacity *= 2;
+	}
+	
+	uint8_t *bytes = (uint8_t*)realloc(buffer->bytes, capacity * sizeof(uint8_t));
+	
+	if (bytes == NULL) {
+		buffer->isFailed = true;
+		return false;
+	}
+	
+	buffer->capacity = capacity;
+	buffer->bytes = bytes;
+	return true;
 }
 
 // Put a U8 value to a buffer.
 static void putU8(Buffer *buffer, uint8_t value) {
-	if (buffer->count == buffer->capacity) {
-		buffer->capacity = buffer->capacity != 0 ? buffer->capacity * 2 : 8;
-		buffer->bytes = (uint8_t*)realloc(buffer->bytes, buffer->capacity * sizeof(uint8_t));
-		
-		if (buffer->bytes == NULL) {
-			exit(EXIT_FAILURE);
-		}
+	if (reserveBuffer(buffer, 1)) {
+		buffer->bytes[buffer->count++] = value;
+	}
+}
+
+// Put bytes to a buffer.
+static void putBytes(Buffer *buffer, const uint8_t *bytes, int count) {
+	if (count == 0 || !reserveBuffer(buffer, count)) {
+		return;
 	}
 	
-	buffer->bytes[buffer->count++] = value;
+	memcpy(buffer->bytes + buffer->count, bytes, count);
+	buffer->count += count;
 }
 
 // Put a U16 value to a buffer.
@@ -43,6 +113,131 @@ static void putU16(Buffer *buffer, uint16_t value) {
 	putU8(buffer, (value >> 8) & 0xff);
 }
 
+// Put a U32 value to a buffer.
+static void putU32(Buffer *buffer, uint32_t value) {
+	putU16(buffer, value & 0xffff);
+	putU16(buffer, (value >> 16) & 0xffff);
+}
+
+// Put a branch opcode with a placeholder U8 branch operand to a buffer and
+// return the branch's index, or -1 if memory could not be allocated.
+static int putBranch(Buffer *buffer, Opcode opcode) {
+	if (buffer->branchCount == buffer->branchCapacity) {
+		int capacity = buffer->branchCapacity != 0 ? buffer->branchCapacity * 2 : 8;
+		Branch *branches = (Branch*)realloc(buffer->branches, capacity * sizeof(Branch));
+		
+		if (branches == NULL) {
+			buffer->isFailed = true;
+			return -1;
+		}
+		
+		buffer->branchCapacity = capacity;
+		buffer->branches = branches;
+	}
+	
+	Branch *branch = &buffer->branches[buffer->branchCount];
+	branch->address = buffer->count;
+	branch->target = -1;
+	branch->targetIndex = -1;
+	branch->operandSize = 1;
+	putU8(buffer, opcode);
+	putU8(buffer, 0);
+	return buffer->branchCount++;
+}
+
+// Patch a branch's target in a buffer to an address and the number of
+// branches before it if the branch could be put.
+static void patchBranch(Buffer *buffer, int index, int target, int targetIndex) {
+	if (index == -1) {
+		return;
+	}
+	
+	buffer->branches[index].target = target;
+	buffer->branches[index].targetIndex = targetIndex;
+}
+
+// Put a loop's start address and source code position to a buffer's loop table
+// and return the loop's index, or -1 if the buffer does not record loops or
+// memory could not be allocated.
+static int putLoop(Buffer *buffer, int start, size_t position) {
+	LoopTable *loops = buffer->loops;
+	
+	if (loops == NULL) {
+		return -1;
+	}
+	
+	if (loops->count == loops->capacity) {
+		int capacity = loops->capacity != 0 ? loops->capacity * 2 : 8;
+		LoopPosition *positions = (LoopPosition*)realloc(loops->loops, capacity * sizeof(LoopPosition));
+		
+		if (positions == NULL) {
+			buffer->isFailed = true;
+			return -1;
+		}
+		
+		loops->capacity = capacity;
+		loops->loops = positions;
+	}
+	
+	LoopPosition *loop = &loops->loops[loops->count];
+	loop->start = start;
+	loop->end = -1;
+	loop->position = position;
+	loop->line = 0;
+	loop->column = 0;
+	return loops->count++;
+}
+
+// Patch a loop's end address in a buffer's loop table if the buffer records
+// loops.
+static void patchLoop(Buffer *buffer, int index, int end) {
+	if (index != -1) {
+		buffer->loops->loops[index].end = end;
+	}
+}
+
+// Patch a U32 value in a buffer at an address.
+static void patchU32(Buffer *buffer, int address, uint32_t value) {
+	for (int i = 0; i < 4; i++) {
+		buffer->bytes[address + i] = (value >> (i * 8)) & 0xff;
+	}
+}
+
+// A decoded instruction for fusing superinstructions.
+typedef struct {
+	// The instruction's opcode.
+	Opcode opcode;
+	
+	// The instruction's address in unfused bytecode.
+	int address;
+	
+	// The index of the instruction's branch target, or -1 if the instruction
+	// does not branch.
+	int target;
+	
+	// Whether the instruction is a branch target.
+	bool isTarget;
+	
+	// The opcode that the instruction is fused into.
+	Opcode fusedOpcode;
+	
+	// The instruction's fused opcode's address in fused bytecode.
+	int fusedAddress;
+	
+	// The address after the instruction's fused opcode in fused bytecode.
+	int fusedEnd;
+} Instruction;
+
+// Get a U16 value from bytes.
+static uint16_t getU16(uint8_t *bytes) {
+	return (uint16_t)((bytes[1] << 8) | bytes[0]);
+}
+
+// Get a U32 value from bytes.
+static uint32_t getU32(uint8_t *bytes) {
+	return (uint32_t)getU16(bytes) | (uint32_t)getU16(bytes + 2) << 16;
+}
+
 // Generate bytecode from a node.
 static void generateNodeBytecode(Buffer *buffer, Node *node);
 
@@ -55,52 +250,48 @@ static void generateProgramNodeBytecode(Buffer *buffer, Node *node) {
 	putU8(buffer, OP_HLT);
 }
 
-// Generate bytecode from a loop node.
+// Generate bytecode from a loop node or a repeat node. The loop's branches
+// are relaxed after the whole program is generated.
 static void generateLoopNodeBytecode(Buffer *buffer, Node *node) {
-	Buffer body;
-	initBuffer(&body);
+	int loop = putLoop(buffer, buffer->count, node->position);
+	int start = putBranch(buffer, OP_BRZ_U8);
+	int bodyAddress = buffer->count;
 	
 	for (int i = 0; i < node->childCount; i++) {
-		generateNodeBytecode(&body, node->children[i]);
-	}
-	
-	uint32_t offset = (uint32_t)(body.count + 2);
-	
-	if (offset > UINT8_MAX) {
-		offset++;
-	}
-	
-	if (offset > UINT16_MAX) {
-		fprintf(stderr, "Could not compile loop because it contains too much code.\n");
-		exit(EXIT_FAILURE);
+		generateNodeBytecode(buffer, node->children[i]);
 	}
 	
-	if (offset <= UINT8_MAX) {
-		putU8(buffer, OP_BRZ_U8);
-		putU8(buffer, offset);
-	} else {
-		putU8(buffer, OP_BRZ_U16);
-		putU16(buffer, offset);
+	// Repeat nodes count down their iterations in their pointed memory, which
+	// their children never access.
+	if (node->kind == NODE_REPEAT) {
+		putU8(buffer, OP_DEC);
 	}
 	
-	for (int i = 0; i < body.count; i++) {
-		putU8(buffer, body.bytes[i]);
+	// Loops that run at most once do not need a backward branch.
+	if (!isLoopOnce(node)) {
+		int end = putBranch(buffer, OP_BNZ_U8);
+		patchBranch(buffer, end, bodyAddress, start + 1);
 	}
 	
-	free(body.bytes);
-	
-	if (offset <= UINT8_MAX) {
-		putU8(buffer, OP_BNZ_U8);
-		putU8(buffer, offset);
-	} else {
-		putU8(buffer, OP_BNZ_U16);
-		putU16(buffer, offset);
-	}
+	patchBranch(buffer, start, buffer->count, buffer->branchCount);
+	patchLoop(buffer, loop, buffer->count);
 }
 
 // Generate bytecode from a move node.
 static void generateMoveNodeBytecode(Buffer *buffer, Node *node) {
-	int16_t value = (int16_t)node->value;
+	int value = node->value;
+	
+	// Split moves that are too far for a single operation. This is exact for
+	// bounded tapes and equivalent to a single move for wrapping tapes.
+	for (; value > UINT16_MAX; value -= UINT16_MAX) {
+		putU8(buffer, OP_RGT_U16);
+		putU16(buffer, UINT16_MAX);
+	}
+	
+	for (; value < -UINT16_MAX; value += UINT16_MAX) {
+		putU8(buffer, OP_LFT_U16);
+		putU16(buffer, UINT16_MAX);
+	}
 	
 	if (value == 1) {
 		putU8(buffer, OP_RGT);
@@ -125,7 +316,11 @@ static void generateMoveNodeBytecode(Buffer *buffer, Node *node) {
 static void generateAddNodeBytecode(Buffer *buffer, Node *node) {
 	int8_t value = (int8_t)node->value;
 	
-	if (value == 1) {
+	if (node->offset != 0) {
+		putU8(buffer, OP_ADD_OFF);
+		putU16(buffer, (uint16_t)node->offset);
+		putU8(buffer, (uint8_t)value);
+	} else if (value == 1) {
 		putU8(buffer, OP_INC);
 	} else if (value > 1) {
 		putU8(buffer, OP_INC_U8);
@@ -142,7 +337,11 @@ static void generateAddNodeBytecode(Buffer *buffer, Node *node) {
 static void generateSetNodeBytecode(Buffer *buffer, Node *node) {
 	uint8_t value = (uint8_t)node->value;
 	
-	if (value == 0) {
+	if (node->offset != 0) {
+		putU8(buffer, OP_SET_OFF);
+		putU16(buffer, (uint16_t)node->offset);
+		putU8(buffer, value);
+	} else if (value == 0) {
 		putU8(buffer, OP_SET_0);
 	} else if (value == 1) {
 		putU8(buffer, OP_SET_1);
@@ -152,6 +351,79 @@ static void generateSetNodeBytecode(Buffer *buffer, Node *node) {
 	}
 }
 
+// Generate bytecode from an output node.
+static void generateOutputNodeBytecode(Buffer *buffer, Node *node) {
+	if (node->offset != 0) {
+		putU8(buffer, OP_OUT_OFF);
+		putU16(buffer, (uint16_t)node->offset);
+	} else {
+		putU8(buffer, OP_OUT);
+	}
+}
+
+// Generate bytecode from an input node.
+static void generateInputNodeBytecode(Buffer *buffer, Node *node) {
+	if (node->offset != 0) {
+		putU8(buffer, OP_INP_OFF);
+		putU16(buffer, (uint16_t)node->offset);
+	} else {
+		putU8(buffer, OP_INP);
+	}
+}
+
+// Generate bytecode from a multiply node.
+static void generateMulNodeBytecode(Buffer *buffer, Node *node) {
+	uint8_t value = (uint8_t)node->value;
+	
+	if (value == 1) {
+		putU8(buffer, OP_COPY);
+		putU16(buffer, (uint16_t)node->offset);
+	} else {
+		putU8(buffer, OP_MUL);
+		putU16(buffer, (uint16_t)node->offset);
+		putU8(buffer, value);
+	}
+}
+
+// Generate bytecode from a scan node.
+static void generateScanNodeBytecode(Buffer *buffer, Node *node) {
+	int value = node->value;
+	
+	if (value == 1) {
+		putU8(buffer, OP_SCN_RGT);
+	} else if (value > 1) {
+		putU8(buffer, OP_SCN_RGT_U8);
+		putU8(buffer, value);
+	} else if (value == -1) {
+		putU8(buffer, OP_SCN_LFT);
+	} else {
+		putU8(buffer, OP_SCN_LFT_U8);
+		putU8(buffer, -value);
+	}
+}
+
+// Generate bytecode from a repeat node.
+static void generateRepeatNodeBytecode(Buffer *buffer, Node *node) {
+	if ((uint8_t)node->value != 1) {
+		putU8(buffer, OP_CNT_U8);
+		putU8(buffer, node->value);
+	}
+	
+	generateLoopNodeBytecode(buffer, node);
+}
+
+// Generate bytecode from a write node. The data operand is an offset into the
+// literal data until the literal data is appended to the bytecode.
+static void generateWriteNodeBytecode(Buffer *buffer, Node *node) {
+	putU8(buffer, OP_WRITE);
+	putU32(buffer, (uint32_t)buffer->literals->count);
+	putU32(buffer, (uint32_t)node->value);
+	
+	for (int i = 0; i < node->value; i++) {
+		putU8(buffer->literals, node->data[i]);
+	}
+}
+
 // Generate bytecode from a node.
 static void generateNodeBytecode(Buffer *buffer, Node *node) {
 	switch (node->kind) {
@@ -159,25 +431,407 @@ static void generateNodeBytecode(Buffer *buffer, Node *node) {
 		case NODE_LOOP: generateLoopNodeBytecode(buffer, node); break;
 		case NODE_MOVE: generateMoveNodeBytecode(buffer, node); break;
 		case NODE_ADD: generateAddNodeBytecode(buffer, node); break;
-		case NODE_OUTPUT: putU8(buffer, OP_OUT); break;
-		case NODE_INPUT: putU8(buffer, OP_INP); break;
+		case NODE_OUTPUT: generateOutputNodeBytecode(buffer, node); break;
+		case NODE_INPUT: generateInputNodeBytecode(buffer, node); break;
 		case NODE_SET: generateSetNodeBytecode(buffer, node); break;
+		case NODE_MUL: generateMulNodeBytecode(buffer, node); break;
+		case NODE_SCAN: generateScanNodeBytecode(buffer, node); break;
+		case NODE_REPEAT: generateRepeatNodeBytecode(buffer, node); break;
+		case NODE_WRITE: generateWriteNodeBytecode(buffer, node); break;
+	}
+}
+
+// Get the distance of a branch in a buffer from the end of the branch to its
+// target after relaxation from the number of bytes that branches before each
+// branch have grown by.
+static int getBranchDistance(Buffer *buffer, int index, int *growths) {
+	Branch *branch = &buffer->branches[index];
+	int end = branch->address + 2 + growths[index + 1];
+	int target = branch->target + growths[branch->targetIndex];
+	return target > end ? target - end : end - target;
+}
+
+// Get the address after relaxation of an address in a buffer from the number of
+// bytes that branches before each branch have grown by.
+static int getRelaxedAddress(Buffer *buffer, int address, int *growths) {
+	int low = 0;
+	int high = buffer->branchCount;
+	
+	while (low < high) {
+		int middle = low + (high - low) / 2;
+		
+		if (buffer->branches[middle].address < address) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	
+	return address + growths[low];
+}
+
+// Get the branch operand size in bytes needed for a branch distance.
+static int getBranchOperandSize(int distance) {
+	if (distance <= UINT8_MAX) {
+		return 1;
+	} else if (distance <= UINT16_MAX) {
+		return 2;
+	} else {
+		return 4;
 	}
 }
 
-// Compile bytecode from a program.
-uint8_t *compileProgram(Node *program) {
+// Relax the placeholder branch operands in bytecode to U8, U16, or U32 branch
+// operands and patch them with their branch offsets.
+static void relaxBranches(Buffer *buffer) {
+	// All branches start with U8 branch operands and are widened until every
+	// branch fits. Widening a branch never brings other branches closer to
+	// their targets, so widened branches never need to be narrowed again.
+	int *growths = (int*)malloc((buffer->branchCount + 1) * sizeof(int));
+	
+	if (growths == NULL) {
+		buffer->isFailed = true;
+		return;
+	}
+	
+	bool hasChanges = true;
+	
+	while (hasChanges) {
+		hasChanges = false;
+		growths[0] = 0;
+		
+		for (int i = 0; i < buffer->branchCount; i++) {
+			growths[i + 1] = growths[i] + buffer->branches[i].operandSize - 1;
+		}
+		
+		for (int i = 0; i < buffer->branchCount; i++) {
+			Branch *branch = &buffer->branches[i];
+			int operandSize = getBranchOperandSize(getBranchDistance(buffer, i, growths));
+			
+			if (operandSize > branch->operandSize) {
+				branch->operandSize = operandSize;
+				hasChanges = true;
+			}
+		}
+	}
+	
+	Buffer relaxed;
+	initBuffer(&relaxed, buffer->literals);
+	int address = 0;
+	
+	for (int i = 0; i < buffer->branchCount; i++) {
+		Branch *branch = &buffer->branches[i];
+		putBytes(&relaxed, buffer->bytes + address, branch->address - address);
+		address = branch->address + 2;
+		bool isForward = buffer->bytes[branch->address] == OP_BRZ_U8;
+		int distance = getBranchDistance(buffer, i, growths);
+		
+		switch (branch->operandSize) {
+			case 1:
+				putU8(&relaxed, isForward ? OP_BRZ_U8 : OP_BNZ_U8);
+				putU8(&relaxed, distance);
+				break;
+			case 2:
+				putU8(&relaxed, isForward ? OP_BRZ_U16 : OP_BNZ_U16);
+				putU16(&relaxed, distance);
+				break;
+			default:
+				putU8(&relaxed, isForward ? OP_BRZ_U32 : OP_BNZ_U32);
+				putU32(&relaxed, distance);
+				break;
+		}
+	}
+	
+	putBytes(&relaxed, buffer->bytes + address, buffer->count - address);
+	
+	if (relaxed.isFailed) {
+		free(relaxed.bytes);
+		free(growths);
+		buffer->isFailed = true;
+		return;
+	}
+	
+	relaxed.loops = buffer->loops;
+	
+	for (int i = 0; relaxed.loops != NULL && i < relaxed.loops->count; i++) {
+		LoopPosition *loop = &relaxed.loops->loops[i];
+		loop->start = getRelaxedAddress(buffer, loop->start, growths);
+		loop->end = getRelaxedAddress(buffer, loop->end, growths);
+	}
+	
+	free(growths);
+	free(buffer->branches);
+	free(buffer->bytes);
+	*buffer = relaxed;
+}
+
+// Decode the instructions in unfused bytecode and find their branch targets.
+// Return NULL if memory could not be allocated.
+static Instruction *decodeInstructions(Buffer *buffer, int *count) {
+	*count = 0;
+	
+	for (int address = 0; address < buffer->count; (*count)++) {
+		address += getInstructionSize((Opcode)buffer->bytes[address]);
+	}
+	
+	Instruction *instructions = (Instruction*)malloc(*count * sizeof(Instruction));
+	int *indices = (int*)malloc((buffer->count + 1) * sizeof(int));
+	
+	if (instructions == NULL || indices == NULL) {
+		free(instructions);
+		free(indices);
+		return NULL;
+	}
+	
+	for (int i = 0, address = 0; i < *count; i++) {
+		Instruction *instruction = &instructions[i];
+		instruction->opcode = (Opcode)buffer->bytes[address];
+		instruction->address = address;
+		instruction->target = -1;
+		instruction->isTarget = false;
+		indices[address] = i;
+		address += getInstructionSize(instruction->opcode);
+	}
+	
+	for (int i = 0; i < *count; i++) {
+		Instruction *instruction = &instructions[i];
+		uint8_t *operand = &buffer->bytes[instruction->address + 1];
+		int end = instruction->address + getInstructionSize(instruction->opcode);
+		int target;
+		
+		switch (getOpcodeInfo(instruction->opcode)->operands) {
+			case OPERANDS_BRZ_U8: target = end + operand[0]; break;
+			case OPERANDS_BRZ_U16: target = end + getU16(operand); break;
+			case OPERANDS_BRZ_U32: target = end + getU32(operand); break;
+			case OPERANDS_BNZ_U8: target = end - operand[0]; break;
+			case OPERANDS_BNZ_U16: target = end - getU16(operand); break;
+			case OPERANDS_BNZ_U32: target = end - getU32(operand); break;
+			default: continue;
+		}
+		
+		instruction->target = indices[target];
+		instructions[instruction->target].isTarget = true;
+	}
+	
+	free(indices);
+	return instructions;
+}
+
+// Get the fused address of an instruction's address in unfused bytecode. The
+// address must be an instruction's address, which is always true of loop
+// addresses because bytecode ends with an HLT opcode.
+static int getFusedAddress(Instruction *instructions, int count, int address) {
+	int low = 0;
+	int high = count - 1;
+	
+	while (low < high) {
+		int middle = low + (high - low) / 2;
+		
+		if (instructions[middle].address < address) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	
+	return instructions[low].fusedAddress;
+}
+
+// Return whether a sequence of instructions can be fused into an opcode.
+// Instructions after the first cannot be branch targets because branches can
+// only enter a superinstruction from its start.
+static bool isSequenceFusible(Instruction *instructions, int count, Opcode opcode) {
+	const OpcodeInfo *info = getOpcodeInfo(opcode);
+	
+	if (info->length > count) {
+		return false;
+	}
+	
+	for (int i = 0; i < info->length; i++) {
+		if (instructions[i].opcode != info->sequence[i] || (i > 0 && instructions[i].isTarget)) {
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+// Fuse sequences of instructions in bytecode into superinstructions. Fusing
+// only removes opcodes, so branches keep their operand sizes.
+static void fuseBytecode(Buffer *buffer) {
+	int count;
+	Instruction *instructions = decodeInstructions(buffer, &count);
+	
+	if (instructions == NULL) {
+		buffer->isFailed = true;
+		return;
+	}
+	
+	int fusedAddress = 0;
+	
+	for (int i = 0; i < count;) {
+		Opcode fusedOpcode = instructions[i].opcode;
+		int length = 1;
+		
+		for (int opcode = 0; opcode < OPCODE_COUNT; opcode++) {
+			int sequenceLength = getOpcodeInfo((Opcode)opcode)->length;
+			
+			if (sequenceLength > length && isSequenceFusible(&instructions[i], count - i, (Opcode)opcode)) {
+				fusedOpcode = (Opcode)opcode;
+				length = sequenceLength;
+			}
+		}
+		
+		int fusedEnd = fusedAddress + getInstructionSize(fusedOpcode);
+		
+		for (int j = i; j < i + length; j++) {
+			instructions[j].fusedOpcode = fusedOpcode;
+			instructions[j].fusedAddress = fusedAddress;
+			instructions[j].fusedEnd = fusedEnd;
+		}
+		
+		fusedAddress = fusedEnd;
+		i += length;
+	}
+	
+	Buffer fused;
+	initBuffer(&fused, buffer->literals);
+	
+	for (int i = 0; i < count; i++) {
+		Instruction *instruction = &instructions[i];
+		Operands operands = getOpcodeInfo(instruction->opcode)->operands;
+		uint8_t *operand = &buffer->bytes[instruction->address + 1];
+		
+		if (fused.count == instruction->fusedAddress) {
+			putU8(&fused, instruction->fusedOpcode);
+		}
+		
+		if (instruction->target == -1) {
+			putBytes(&fused, operand, getOperandsSize(operands));
+			continue;
+		}
+		
+		// Branches are always last in a superinstruction, so they branch from
+		// the end of their fused opcode.
+		int targetAddress = instructions[instruction->target].fusedAddress;
+		
+		switch (operands) {
+			case OPERANDS_BRZ_U8: putU8(&fused, targetAddress - instruction->fusedEnd); break;
+			case OPERANDS_BRZ_U16: putU16(&fused, targetAddress - instruction->fusedEnd); break;
+			case OPERANDS_BRZ_U32: putU32(&fused, targetAddress - instruction->fusedEnd); break;
+			case OPERANDS_BNZ_U8: putU8(&fused, instruction->fusedEnd - targetAddress); break;
+			case OPERANDS_BNZ_U16: putU16(&fused, instruction->fusedEnd - targetAddress); break;
+			case OPERANDS_BNZ_U32: putU32(&fused, instruction->fusedEnd - targetAddress); break;
+			default: break;
+		}
+	}
+	
+	if (fused.isFailed) {
+		free(fused.bytes);
+		free(instructions);
+		buffer->isFailed = true;
+		return;
+	}
+	
+	fused.loops = buffer->loops;
+	
+	for (int i = 0; fused.loops != NULL && i < fused.loops->count; i++) {
+		LoopPosition *loop = &fused.loops->loops[i];
+		loop->start = getFusedAddress(instructions, count, loop->start);
+		loop->end = getFusedAddress(instructions, count, loop->end);
+	}
+	
+	free(instructions);
+	free(buffer->bytes);
+	*buffer = fused;
+}
+
+// Append literal data to bytecode after its HLT opcode and make data operands
+// relative to themselves.
+static void appendLiterals(Buffer *buffer) {
+	int count = buffer->count;
+	
+	for (int address = 0; address < count;) {
+		const OpcodeInfo *info = getOpcodeInfo((Opcode)buffer->bytes[address]);
+		address++;
+		
+		for (int i = 0; i < info->length; i++) {
+			Operands operands = getOpcodeInfo(info->sequence[i])->operands;
+			
+			if (operands == OPERANDS_DATA) {
+				uint32_t literal = getU32(&buffer->bytes[address]);
+				patchU32(buffer, address, (uint32_t)(count - (address + 4)) + literal);
+			}
+			
+			address += getOperandsSize(operands);
+		}
+	}
+	
+	putBytes(buffer, buffer->literals->bytes, buffer->literals->count);
+}
+
+// Compile bytecode from a program and get its size in bytes. Fill an optional
+// loop table with the loops in the bytecode. Return NULL if memory could not
+// be allocated.
+uint8_t *compileProgram(Node *program, size_t *size, LoopTable *loops) {
+	Buffer literals;
+	initBuffer(&literals, NULL);
 	Buffer buffer;
-	initBuffer(&buffer);
+	initBuffer(&buffer, &literals);
+	
+	if (loops != NULL) {
+		loops->count = 0;
+		loops->capacity = 0;
+		loops->loops = NULL;
+		buffer.loops = loops;
+	}
+	
+	// Each step is skipped once memory could not be allocated for a buffer.
 	generateNodeBytecode(&buffer, program);
+	buffer.isFailed = buffer.isFailed || literals.isFailed;
+	
+	if (!buffer.isFailed) {
+		relaxBranches(&buffer);
+	}
+	
+	if (!buffer.isFailed) {
+		fuseBytecode(&buffer);
+	}
+	
+	if (!buffer.isFailed) {
+		appendLiterals(&buffer);
+	}
+	
+	free(literals.bytes);
 	
+	if (buffer.isFailed) {
+		free(buffer.bytes);
+		free(buffer.branches);
+		
+		if (loops != NULL) {
+			freeLoopTable(loops);
+		}
+		
+		return NULL;
+	}
+	
+	// Bytecode that cannot be shrunk to fit is kept at its capacity.
 	if (buffer.capacity > buffer.count) {
-		buffer.bytes = (uint8_t*)realloc(buffer.bytes, buffer.count * sizeof(uint8_t));
+		uint8_t *bytes = (uint8_t*)realloc(buffer.bytes, buffer.count * sizeof(uint8_t));
 		
-		if (buffer.bytes == NULL) {
-			exit(EXIT_FAILURE);
+		if (bytes != NULL) {
+			buffer.bytes = bytes;
 		}
 	}
 	
+	*size = (size_t)buffer.count;
 	return buffer.bytes;
 }
+
+// Free a loop table.
+void freeLoopTable(LoopTable *loops) {
+	free(loops->loops);
+	loops->count = 0;
+	loops->capacity = 0;
+	loops->loops = NULL;
+}
@@ -1,11 +1,47 @@
 #ifndef BRAINIAC_GENERATOR_H
 #define BRAINIAC_GENERATOR_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "node.h"
 
-// Compile bytecode from a program.
-uint8_t *compileProgram(Node *program);
+// A loop's addresses in bytecode and position in source code.
+typedef struct {
+	// The address of the loop's first instruction.
+	int start;
+	
+	// The address after the loop's last instruction.
+	int end;
+	
+	// The offset of the loop's '[' command in source code.
+	size_t position;
+	
+	// The line number of the loop's '[' command, or 0 if it was not found.
+	int line;
+	
+	// The column number of the loop's '[' command, or 0 if it was not found.
+	int column;
+} LoopPosition;
+
+// A table of the loops in bytecode by start address.
+typedef struct {
+	// The number of loops in the table.
+	int count;
+	
+	// The table's loop capacity.
+	int capacity;
+	
+	// The table's loops.
+	LoopPosition *loops;
+} LoopTable;
+
+// Compile bytecode from a program and get its size in bytes. Fill an optional
+// loop table with the loops in the bytecode. Return NULL if memory could not
+// be allocated.
+uint8_t *compileProgram(Node *program, size_t *size, LoopTable *loops);
+
+// Free a loop table.
+void freeLoopTable(LoopTable *loops);
 
 #endif // BRAINIAC_GENERATOR_H
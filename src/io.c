@@ -0,0 +1,242 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "io.h"
+
+// The input and output for standard input and standard output.
+static IO standardIO;
+
+// Initialize an I/O buffer from its capacity.
+static void initIOBuffer(IOBuffer *buffer, size_t capacity) {
+	buffer->count = 0;
+	buffer->next = 0;
+	
+	if (buffer->bytes != NULL && buffer->capacity == capacity) {
+		return;
+	}
+	
+	buffer->capacity = capacity;
+	buffer->bytes = (uint8_t*)realloc(buffer->bytes, capacity * sizeof(uint8_t));
+	
+	if (buffer->bytes == NULL) {
+		exit(EXIT_FAILURE);
+	}
+}
+
+// Get the input and output for standard input and standard output.
+IO *getStandardIO() {
+	return &standardIO;
+}
+
+// Initialize input and output from optional files, a buffering mode, and an
+// output buffer size. Buffers from a previous initialization are reused, so
+// input and output must be zeroed before they are first initialized.
+void initIO(IO *io, FILE *inputFile, FILE *outputFile, IOMode mode, size_t bufferSize) {
+	io->inputFile = inputFile;
+	io->outputFile = outputFile;
+	io->reader = NULL;
+	io->writer = NULL;
+	io->context = NULL;
+	io->isLineFlushed = mode == IO_LINE;
+	io->isBlockInput = false;
+	io->readCount = 0;
+	io->writtenCount = 0;
+#ifndef _WIN32
+	// Fully buffered output to a terminal is still flushed after each line so
+	// that long-running programs show their progress.
+	if (mode == IO_FULL) {
+		io->isLineFlushed = outputFile != NULL && isatty(fileno(outputFile));
+		io->isBlockInput = true;
+	}
+#endif // _WIN32
+	initIOBuffer(&io->output, mode == IO_UNBUFFERED || bufferSize == 0 ? 1 : bufferSize);
+	initIOBuffer(&io->input, io->isBlockInput ? 65536 : 1);
+}
+
+// Initialize input and output from a reader, a writer, their context, and an
+// output buffer size. Input is read in blocks and output is flushed when the
+// buffer is full. Buffers are reused in the same way as initIO.
+void initCustomIO(IO *io, IOReader *reader, IOWriter *writer, void *context, size_t bufferSize) {
+	initIO(io, NULL, NULL, IO_FULL, bufferSize);
+	io->reader = reader;
+	io->writer = writer;
+	io->context = context;
+	io->isBlockInput = true;
+	initIOBuffer(&io->input, 65536);
+}
+
+// Free input and output's buffers.
+void freeIO(IO *io) {
+	free(io->output.bytes);
+	free(io->input.bytes);
+	io->output.bytes = NULL;
+	io->input.bytes = NULL;
+}
+
+// Output a byte.
+void outputByte(IO *io, uint8_t value) {
+	IOBuffer *output = &io->output;
+	output->bytes[output->count++] = value;
+	
+	if (output->count == output->capacity || (io->isLineFlushed && value == '\n')) {
+		flushOutput(io);
+	}
+}
+
+// Output bytes.
+void outputBytes(IO *io, const uint8_t *bytes, size_t count) {
+	IOBuffer *output = &io->output;
+	
+	if (io->isLineFlushed) {
+		for (size_t i = 0; i < count; i++) {
+			outputByte(io, bytes[i]);
+		}
+		
+		return;
+	}
+	
+	// Bytes that do not fit in the buffer are written directly after flushing
+	// it.
+	if (output->count + count > output->capacity) {
+		flushOutput(io);
+		
+		if (count >= output->capacity) {
+			if (io->writer != NULL) {
+				io->writer(io->context, bytes, count);
+			} else if (io->outputFile != NULL) {
+				fwrite(bytes, sizeof(uint8_t), count, io->outputFile);
+				fflush(io->outputFile);
+			}
+			
+			io->writtenCount += count;
+			return;
+		}
+	}
+	
+	memcpy(output->bytes + output->count, bytes, count);
+	output->count += count;
+	
+	if (output->count == output->capacity) {
+		flushOutput(io);
+	}
+}
+
+// Fill the input buffer and return whether any bytes were input.
+static bool fillInput(IO *io) {
+	IOBuffer *input = &io->input;
+	input->next = 0;
+	input->count = 0;
+	
+	if (io->reader != NULL) {
+		input->count = io->reader(io->context, input->bytes, input->capacity);
+		io->readCount += input->count;
+		return input->count > 0;
+	} else if (io->inputFile == NULL) {
+		return false;
+	}
+#ifndef _WIN32
+	if (io->isBlockInput) {
+		int descriptor = fileno(io->inputFile);
+		ssize_t count;
+		
+		do {
+			count = read(descriptor, input->bytes, input->capacity);
+		} while (count < 0 && errno == EINTR);
+		
+		if (count > 0) {
+			input->count = (size_t)count;
+			io->readCount += input->count;
+		}
+		
+		return input->count > 0;
+	}
+#endif // _WIN32
+	int value = getc(io->inputFile);
+	
+	if (value == EOF) {
+		return false;
+	}
+	
+	input->bytes[input->count++] = (uint8_t)value;
+	io->readCount++;
+	return true;
+}
+
+// Input a byte, or 0 at the end of input.
+uint8_t inputByte(IO *io) {
+	IOBuffer *input = &io->input;
+	
+	if (input->next == input->count) {
+		flushOutput(io);
+		
+		if (!fillInput(io)) {
+			return 0;
+		}
+	}
+	
+	return input->bytes[input->next++];
+}
+
+// Flush buffered output.
+void flushOutput(IO *io) {
+	IOBuffer *output = &io->output;
+	
+	if (io->writer != NULL || io->outputFile == NULL) {
+		if (io->writer != NULL && output->count > 0) {
+			io->writer(io->context, output->bytes, output->count);
+		}
+		
+		io->writtenCount += output->count;
+		output->count = 0;
+		return;
+	}
+	
+	if (output->count > 0) {
+		fwrite(output->bytes, sizeof(uint8_t), output->count, io->outputFile);
+		io->writtenCount += output->count;
+		output->count = 0;
+	}
+	
+	fflush(io->outputFile);
+}
+
+// Flush buffered output without using stdio, so that it can be called from a
+// signal handler.
+void flushOutputRaw(IO *io) {
+#ifndef _WIN32
+	IOBuffer *output = &io->output;
+	int descriptor = io->outputFile != NULL ? fileno(io->outputFile) : -1;
+	size_t written = 0;
+	
+	while (descriptor >= 0 && written < output->count) {
+		ssize_t count = write(descriptor, output->bytes + written, output->count - written);
+		
+		if (count <= 0) {
+			break;
+		}
+		
+		written += (size_t)count;
+	}
+	
+	io->writtenCount += written;
+	output->count = 0;
+#else // _WIN32
+	(void)io;
+#endif // _WIN32
+}
+
+// Get the number of bytes input and output since input and output were
+// initialized. Output bytes are only counted once they are flushed.
+void getIOCounts(const IO *io, uint64_t *inputCount, uint64_t *outputCount) {
+	*inputCount = io->readCount - (io->input.count - io->input.next);
+	*outputCount = io->writtenCount;
+}
@@ -0,0 +1,112 @@
+#ifndef BRAINIAC_IO_H
+#define BRAINIAC_IO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// A mode for buffering input and output.
+typedef enum {
+	IO_UNBUFFERED, // Write output immediately and read input by character.
+	IO_LINE, // Flush output after each line and read input by character.
+	IO_FULL, // Flush output when the buffer is full and read input in blocks.
+} IOMode;
+
+// Read up to a capacity of input bytes from a context and return the number of
+// bytes read, or 0 at the end of input.
+typedef size_t IOReader(void *context, uint8_t *bytes, size_t capacity);
+
+// Write output bytes to a context.
+typedef void IOWriter(void *context, const uint8_t *bytes, size_t count);
+
+// A buffer of bytes for input or output.
+typedef struct {
+	// The number of bytes in the buffer.
+	size_t count;
+	
+	// The buffer's byte capacity.
+	size_t capacity;
+	
+	// The index of the next byte to input from the buffer.
+	size_t next;
+	
+	// The buffer's bytes.
+	uint8_t *bytes;
+} IOBuffer;
+
+// Buffered input and output for running programs.
+typedef struct {
+	// The file that input is read from, or NULL if there is no input.
+	FILE *inputFile;
+	
+	// The file that output is written to, or NULL if output is discarded.
+	FILE *outputFile;
+	
+	// The function that reads input instead of the input file, or NULL.
+	IOReader *reader;
+	
+	// The function that writes output instead of the output file, or NULL.
+	IOWriter *writer;
+	
+	// The context passed to the reader and writer.
+	void *context;
+	
+	// Whether output is flushed after each line.
+	bool isLineFlushed;
+	
+	// Whether input is read in blocks.
+	bool isBlockInput;
+	
+	// The output buffer.
+	IOBuffer output;
+	
+	// The input buffer.
+	IOBuffer input;
+	
+	// The number of bytes read into the input buffer. Bytes are counted when
+	// the buffers are filled and flushed so that the hot paths are not slowed
+	// down.
+	uint64_t readCount;
+	
+	// The number of bytes written from the output buffer or directly.
+	uint64_t writtenCount;
+} IO;
+
+// Get the input and output for standard input and standard output.
+IO *getStandardIO();
+
+// Initialize input and output from optional files, a buffering mode, and an
+// output buffer size. Buffers from a previous initialization are reused, so
+// input and output must be zeroed before they are first initialized.
+void initIO(IO *io, FILE *inputFile, FILE *outputFile, IOMode mode, size_t bufferSize);
+
+// Initialize input and output from a reader, a writer, their context, and an
+// output buffer size. Input is read in blocks and output is flushed when the
+// buffer is full. Buffers are reused in the same way as initIO.
+void initCustomIO(IO *io, IOReader *reader, IOWriter *writer, void *context, size_t bufferSize);
+
+// Free input and output's buffers.
+void freeIO(IO *io);
+
+// Output a byte.
+void outputByte(IO *io, uint8_t value);
+
+// Output bytes.
+void outputBytes(IO *io, const uint8_t *bytes, size_t count);
+
+// Input a byte, or 0 at the end of input.
+uint8_t inputByte(IO *io);
+
+// Flush buffered output.
+void flushOutput(IO *io);
+
+// Flush buffered output without using stdio, so that it can be called from a
+// signal handler.
+void flushOutputRaw(IO *io);
+
+// Get the number of bytes input and output since input and output were
+// initialized. Output bytes are only counted once they are flushed.
+void getIOCounts(const IO *io, uint64_t *inputCount, uint64_t *outputCount);
+
+#endif // BRAINIAC_IO_H
@@ -0,0 +1,332 @@
+#define _DEFAULT_SOURCE
+
+#include <stdlib.h>
+
+#include "io.h"
+#include "jit.h"
+
+#if defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+#define BRAINIAC_JIT_X64
+#endif // defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+
+#ifdef BRAINIAC_JIT_X64
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+
+// A buffer of machine code.
+typedef struct {
+	// The number of bytes in the buffer.
+	int count;
+	
+	// The buffer's byte capacity.
+	int capacity;
+	
+	// The buffer's bytes.
+	uint8_t *bytes;
+	
+	// The tape that the code is run with.
+	const Tape *tape;
+	
+	// The I/O that the code is run with.
+	IO *io;
+	
+	// Whether the memory pointer wraps at 64 KiB.
+	bool isWrapping;
+} Code;
+
+// Native code compiled from a program. The tape's memory is passed as the only
+// argument and kept in RBX, while the memory pointer is kept in R12 as an
+// index.
+typedef void (*NativeProgram)(uint8_t *memory);
+
+// Initialize a code buffer from the tape and I/O that it is run with.
+static void initCode(Code *code, const Tape *tape, IO *io) {
+	code->count = 0;
+	code->capacity = 0;
+	code->bytes = NULL;
+	code->tape = tape;
+	code->io = io;
+	code->isWrapping = tape->mask != SIZE_MAX;
+}
+
+// Put a U8 value to a code buffer.
+static void putU8(Code *code, uint8_t value) {
+	if (code->count == code->capacity) {
+		code->capacity = code->capacity != 0 ? code->capacity * 2 : 64;
+		code->bytes = (uint8_t*)realloc(code->bytes, code->capacity * sizeof(uint8_t));
+		
+		if (code->bytes == NULL) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	
+	code->bytes[code->count++] = value;
+}
+
+// Put a U16 value to a code buffer.
+static void putU16(Code *code, uint16_t value) {
+	putU8(code, value & 0xff);
+	putU8(code, (value >> 8) & 0xff);
+}
+
+// Put a U32 value to a code buffer.
+static void putU32(Code *code, uint32_t value) {
+	putU16(code, value & 0xffff);
+	putU16(code, (value >> 16) & 0xffff);
+}
+
+// Put a U64 value to a code buffer.
+static void putU64(Code *code, uint64_t value) {
+	putU32(code, value & 0xffffffff);
+	putU32(code, (value >> 32) & 0xffffffff);
+}
+
+// Patch a U32 value in a code buffer at an offset.
+static void patchU32(Code *code, int offset, uint32_t value) {
+	for (int i = 0; i < 4; i++) {
+		code->bytes[offset + i] = (value >> (i * 8)) & 0xff;
+	}
+}
+
+// Put a call to a routine to a code buffer.
+static void putCall(Code *code, void *routine) {
+	putU8(code, 0x48); putU8(code, 0xb8); putU64(code, (uint64_t)(uintptr_t)routine); // mov rax, imm64
+	putU8(code, 0xff); putU8(code, 0xd0); // call rax
+}
+
+// Put an instruction operating on memory at an offset to a code buffer. The
+// instruction's opcode and ModRM reg field are given, and any immediate
+// operand must be put after this.
+static void putMemoryOp(Code *code, int offset, uint8_t opcode, uint8_t reg) {
+	// Offsets on wrapping tapes are wrapped to an index in RAX.
+	bool isIndexed = code->isWrapping && offset != 0;
+	
+	if (isIndexed) {
+		putU8(code, 0x41); putU8(code, 0x8d); putU8(code, 0x84); putU8(code, 0x24); // lea eax, [r12+disp32]
+		putU32(code, (uint32_t)(int32_t)offset);
+		putU8(code, 0x0f); putU8(code, 0xb7); putU8(code, 0xc0); // movzx eax, ax
+	} else {
+		putU8(code, 0x42); // REX.X for [rbx+r12]
+	}
+	
+	if (opcode == 0xb6) {
+		putU8(code, 0x0f); // Two-byte opcode escape for movzx.
+	}
+	
+	putU8(code, opcode);
+	
+	if (isIndexed) {
+		putU8(code, (uint8_t)((reg << 3) | 0x04)); // ModRM with SIB.
+		putU8(code, 0x03); // SIB for [rbx+rax].
+	} else if (offset != 0) {
+		putU8(code, (uint8_t)((reg << 3) | 0x84)); // ModRM with SIB and disp32.
+		putU8(code, 0x23); // SIB for [rbx+r12+disp32].
+		putU32(code, (uint32_t)(int32_t)offset);
+	} else {
+		putU8(code, (uint8_t)((reg << 3) | 0x04)); // ModRM with SIB.
+		putU8(code, 0x23); // SIB for [rbx+r12].
+	}
+}
+
+// Put a comparison of pointed memory with 0 to a code buffer.
+static void putCompareZero(Code *code) {
+	putMemoryOp(code, 0, 0x80, 7); // cmp byte [rbx+r12], imm8
+	putU8(code, 0x00);
+}
+
+// Generate native code from a node.
+static void generateNodeCode(Code *code, Node *node);
+
+// Generate native code from a program node.
+static void generateProgramNodeCode(Code *code, Node *node) {
+	putU8(code, 0x53); // push rbx
+	putU8(code, 0x41); putU8(code, 0x54); // push r12
+	putU8(code, 0x55); // push rbp
+	putU8(code, 0x48); putU8(code, 0x89); putU8(code, 0xfb); // mov rbx, rdi
+	putU8(code, 0x45); putU8(code, 0x31); putU8(code, 0xe4); // xor r12d, r12d
+	
+	for (int i = 0; i < node->childCount; i++) {
+		generateNodeCode(code, node->children[i]);
+	}
+	
+	putU8(code, 0x5d); // pop rbp
+	putU8(code, 0x41); putU8(code, 0x5c); // pop r12
+	putU8(code, 0x5b); // pop rbx
+	putU8(code, 0xc3); // ret
+}
+
+// Generate native code from a loop node.
+static void generateLoopNodeCode(Code *code, Node *node) {
+	putCompareZero(code);
+	putU8(code, 0x0f); putU8(code, 0x84); // je rel32
+	int exitPatch = code->count;
+	putU32(code, 0);
+	int bodyStart = code->count;
+	
+	for (int i = 0; i < node->childCount; i++) {
+		generateNodeCode(code, node->children[i]);
+	}
+	
+	// Loops that run at most once do not need a backward branch.
+	if (!isLoopOnce(node)) {
+		putCompareZero(code);
+		putU8(code, 0x0f); putU8(code, 0x85); // jne rel32
+		putU32(code, (uint32_t)(int32_t)(bodyStart - (code->count + 4)));
+	}
+	
+	patchU32(code, exitPatch, (uint32_t)(int32_t)(code->count - (exitPatch + 4)));
+}
+
+// Generate native code from a repeat node.
+static void generateRepeatNodeCode(Code *code, Node *node) {
+	if ((uint8_t)node->value != 1) {
+		putMemoryOp(code, 0, 0xb6, 1); // movzx ecx, byte [rbx+r12]
+		putU8(code, 0x69); putU8(code, 0xc9); putU32(code, (uint8_t)node->value); // imul ecx, ecx, imm32
+		putMemoryOp(code, 0, 0x88, 1); // mov byte [rbx+r12], cl
+	}
+	
+	putCompareZero(code);
+	putU8(code, 0x0f); putU8(code, 0x84); // je rel32
+	int exitPatch = code->count;
+	putU32(code, 0);
+	int bodyStart = code->count;
+	
+	for (int i = 0; i < node->childCount; i++) {
+		generateNodeCode(code, node->children[i]);
+	}
+	
+	// Iterations are counted down in the pointed memory, which the children
+	// never access.
+	putMemoryOp(code, 0, 0xfe, 1); // dec byte [rbx+r12]
+	putU8(code, 0x0f); putU8(code, 0x85); // jne rel32
+	putU32(code, (uint32_t)(int32_t)(bodyStart - (code->count + 4)));
+	patchU32(code, exitPatch, (uint32_t)(int32_t)(code->count - (exitPatch + 4)));
+}
+
+// Generate native code from a move node.
+static void generateMoveNodeCode(Code *code, Node *node) {
+	if (code->isWrapping) {
+		putU8(code, 0x66); putU8(code, 0x41); putU8(code, 0x81); putU8(code, 0xc4); // add r12w, imm16
+		putU16(code, (uint16_t)node->value);
+	} else {
+		putU8(code, 0x49); putU8(code, 0x81); putU8(code, 0xc4); // add r12, imm32
+		putU32(code, (uint32_t)(int32_t)node->value);
+	}
+}
+
+// Generate native code from an add node.
+static void generateAddNodeCode(Code *code, Node *node) {
+	putMemoryOp(code, node->offset, 0x80, 0); // add byte [memory], imm8
+	putU8(code, (uint8_t)node->value);
+}
+
+// Generate native code from an output node.
+static void generateOutputNodeCode(Code *code, Node *node) {
+	putMemoryOp(code, node->offset, 0xb6, 6); // movzx esi, byte [memory]
+	putU8(code, 0x48); putU8(code, 0xbf); putU64(code, (uint64_t)(uintptr_t)code->io); // mov rdi, imm64
+	putCall(code, (void*)outputByte);
+}
+
+// Generate native code from an input node.
+static void generateInputNodeCode(Code *code, Node *node) {
+	putU8(code, 0x48); putU8(code, 0xbf); putU64(code, (uint64_t)(uintptr_t)code->io); // mov rdi, imm64
+	putCall(code, (void*)inputByte);
+	putU8(code, 0x89); putU8(code, 0xc1); // mov ecx, eax
+	putMemoryOp(code, node->offset, 0x88, 1); // mov byte [memory], cl
+}
+
+// Generate native code from a set node.
+static void generateSetNodeCode(Code *code, Node *node) {
+	putMemoryOp(code, node->offset, 0xc6, 0); // mov byte [memory], imm8
+	putU8(code, (uint8_t)node->value);
+}
+
+// Generate native code from a multiply node.
+static void generateMulNodeCode(Code *code, Node *node) {
+	putMemoryOp(code, 0, 0xb6, 1); // movzx ecx, byte [rbx+r12]
+	
+	if ((uint8_t)node->value != 1) {
+		putU8(code, 0x6b); putU8(code, 0xc9); putU8(code, (uint8_t)node->value); // imul ecx, ecx, imm8
+	}
+	
+	putMemoryOp(code, node->offset, 0x00, 1); // add byte [memory], cl
+}
+
+// Generate native code from a scan node.
+static void generateScanNodeCode(Code *code, Node *node) {
+	putU8(code, 0x48); putU8(code, 0xbf); putU64(code, (uint64_t)(uintptr_t)code->tape); // mov rdi, imm64
+	putU8(code, 0x4c); putU8(code, 0x89); putU8(code, 0xe6); // mov rsi, r12
+	putU8(code, 0xba); putU32(code, (uint32_t)node->value); // mov edx, imm32
+	putCall(code, (void*)scanTape);
+	putU8(code, 0x49); putU8(code, 0x89); putU8(code, 0xc4); // mov r12, rax
+}
+
+// Generate native code from a write node.
+static void generateWriteNodeCode(Code *code, Node *node) {
+	putU8(code, 0x48); putU8(code, 0xbf); putU64(code, (uint64_t)(uintptr_t)code->io); // mov rdi, imm64
+	putU8(code, 0x48); putU8(code, 0xbe); putU64(code, (uint64_t)(uintptr_t)node->data); // mov rsi, imm64
+	putU8(code, 0xba); putU32(code, (uint32_t)node->value); // mov edx, imm32
+	putCall(code, (void*)outputBytes);
+}
+
+// Generate native code from a node.
+static void generateNodeCode(Code *code, Node *node) {
+	switch (node->kind) {
+		case NODE_PROGRAM: generateProgramNodeCode(code, node); break;
+		case NODE_LOOP: generateLoopNodeCode(code, node); break;
+		case NODE_MOVE: generateMoveNodeCode(code, node); break;
+		case NODE_ADD: generateAddNodeCode(code, node); break;
+		case NODE_OUTPUT: generateOutputNodeCode(code, node); break;
+		case NODE_INPUT: generateInputNodeCode(code, node); break;
+		case NODE_SET: generateSetNodeCode(code, node); break;
+		case NODE_MUL: generateMulNodeCode(code, node); break;
+		case NODE_SCAN: generateScanNodeCode(code, node); break;
+		case NODE_REPEAT: generateRepeatNodeCode(code, node); break;
+		case NODE_WRITE: generateWriteNodeCode(code, node); break;
+	}
+}
+#endif // BRAINIAC_JIT_X64
+
+// Return whether native code can be compiled for the host.
+bool isJitSupported() {
+#ifdef BRAINIAC_JIT_X64
+	return true;
+#else // BRAINIAC_JIT_X64
+	return false;
+#endif // BRAINIAC_JIT_X64
+}
+
+// Compile a program to native code and run it with a tape and I/O. Return
+// whether the native code could be run.
+bool jitProgram(Node *program, Tape *tape, IO *io) {
+#ifdef BRAINIAC_JIT_X64
+	Code code;
+	initCode(&code, tape, io);
+	generateNodeCode(&code, program);
+	void *native = mmap(NULL, code.count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	
+	if (native == MAP_FAILED) {
+		free(code.bytes);
+		return false;
+	}
+	
+	memcpy(native, code.bytes, code.count);
+	free(code.bytes);
+	
+	if (mprotect(native, code.count, PROT_READ | PROT_EXEC) != 0) {
+		munmap(native, code.count);
+		return false;
+	}
+	
+	((NativeProgram)native)(tape->memory);
+	flushOutput(io);
+	munmap(native, code.count);
+	return true;
+#else // BRAINIAC_JIT_X64
+	(void)program;
+	(void)tape;
+	(void)io;
+	return false;
+#endif // BRAINIAC_JIT_X64
+}
@@ -0,0 +1,17 @@
+#ifndef BRAINIAC_JIT_H
+#define BRAINIAC_JIT_H
+
+#include <stdbool.h>
+
+#include "io.h"
+#include "node.h"
+#include "tape.h"
+
+// Return whether native code can be compiled for the host.
+bool isJitSupported();
+
+// Compile a program to native code and run it with a tape and I/O. Return
+// whether the native code could be run.
+bool jitProgram(Node *program, Tape *tape, IO *io);
+
+#endif // BRAINIAC_JIT_H
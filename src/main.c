@@ -1,14 +1,424 @@
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "batch.h"
+#include "client.h"
 #include "compiler.h"
+#include "io.h"
+#include "jit.h"
+#include "profiler.h"
+#include "server.h"
+#include "transpiler.h"
 #include "vm.h"
 
+// Options for running Brainiac.
+typedef struct {
+	// The source path, or NULL to run a REPL.
+	const char *path;
+	
+	// Whether programs are compiled to native code.
+	bool isJit;
+	
+	// Whether programs are transpiled to C instead of being run.
+	bool isEmitC;
+	
+	// Whether programs are compiled to the bytecode cache instead of being run.
+	bool isCompileOnly;
+	
+	// Whether programs are profiled instead of being run normally.
+	bool isProfile;
+	
+	// Whether statistics are printed after running programs.
+	bool isStats;
+	
+	// Whether statistics are printed as JSON.
+	bool isStatsJson;
+	
+	// Whether the path is a manifest of jobs to run in a batch.
+	bool isBatch;
+	
+	// The number of loop iterations in each slice of a batch job, or 0 to run
+	// each job to completion.
+	size_t sliceSize;
+	
+	// The maximum number of batch jobs started in slices but not finished at
+	// once.
+	size_t residentLimit;
+	
+	// The maximum number of loop iterations for each program, or 0 for no
+	// limit.
+	size_t fuel;
+	
+	// Whether the path is a socket to serve requests on.
+	bool isServe;
+	
+	// The socket path of a server to run programs on, or NULL to run programs
+	// locally.
+	const char *connectPath;
+	
+	// The number of requests to send to a server in a load test, or 0 to run
+	// a program once.
+	size_t requestCount;
+	
+	// The number of programs cached by a server.
+	size_t cacheSize;
+	
+	// The maximum number of bytes a program run on a server may output, or 0
+	// for no limit.
+	size_t outputLimit;
+	
+	// The number of worker threads for a batch or server, or the number of
+	// connections for a load test. 0 is one per processor.
+	size_t threadCount;
+	
+	// Whether output is written immediately instead of being buffered.
+	bool isUnbuffered;
+	
+	// The size of the output buffer in bytes.
+	size_t bufferSize;
+	
+	// The size of a bounded tape in cells, or 0 for a wrapping 64 KiB tape.
+	size_t tapeSize;
+	
+	// The bytecode VM's dispatch engine.
+	Engine engine;
+} Options;
+
+// Parse a size option's value and return whether it is valid.
+static bool parseSize(const char *arg, size_t *size) {
+	char *end;
+	unsigned long long value = strtoull(arg, &end, 10);
+	
+	if (end == arg || *end != '\0' || value == 0 || value > SIZE_MAX) {
+		return false;
+	}
+	
+	*size = (size_t)value;
+	return true;
+}
+
+// Parse an engine option's value and return whether it is valid.
+static bool parseEngine(const char *arg, Engine *engine) {
+	static const char *names[] = {
+		[ENGINE_SWITCH] = "switch",
+		[ENGINE_GOTO] = "goto",
+		[ENGINE_THREADED] = "threaded",
+		[ENGINE_TAILCALL] = "tailcall",
+	};
+	
+	for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+		if (strcmp(arg, names[i]) == 0) {
+			// Fall back to the default engine if the engine is not supported.
+			*engine = isEngineSupported((Engine)i) ? (Engine)i : getDefaultEngine();
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+// Parse options from command line arguments and return whether they are
+// valid.
+static bool parseOptions(Options *options, int argc, const char *argv[]) {
+	options->path = NULL;
+	options->isJit = false;
+	options->isEmitC = false;
+	options->isCompileOnly = false;
+	options->isProfile = false;
+	options->isStats = false;
+	options->isStatsJson = false;
+	options->isBatch = false;
+	options->sliceSize = 0;
+	options->residentLimit = 256;
+	options->fuel = 0;
+	options->isServe = false;
+	options->connectPath = NULL;
+	options->requestCount = 0;
+	options->cacheSize = 256;
+	options->outputLimit = 0;
+	options->threadCount = 0;
+	options->isUnbuffered = false;
+	options->bufferSize = 65536;
+	options->tapeSize = 0;
+	options->engine = getDefaultEngine();
+	
+	for (int i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		
+		if (strcmp(arg, "--jit") == 0) {
+			// Fall back to the bytecode VM if native code is not supported.
+			options->isJit = isJitSupported();
+		} else if (strcmp(arg, "--emit-c") == 0) {
+			options->isEmitC = true;
+		} else if (strcmp(arg, "--compile-only") == 0) {
+			options->isCompileOnly = true;
+		} else if (strcmp(arg, "--profile") == 0) {
+			options->isProfile = true;
+		} else if (strcmp(arg, "--stats") == 0 || strcmp(arg, "--stats=text") == 0) {
+			options->isStats = true;
+			options->isStatsJson = false;
+		} else if (strcmp(arg, "--stats=json") == 0) {
+			options->isStats = true;
+			options->isStatsJson = true;
+		} else if (strcmp(arg, "--batch") == 0) {
+			options->isBatch = true;
+		} else if (strncmp(arg, "--slice=", 8) == 0) {
+			if (!parseSize(arg + 8, &options->sliceSize)) {
+				return false;
+			}
+		} else if (strncmp(arg, "--resident=", 11) == 0) {
+			if (!parseSize(arg + 11, &options->residentLimit)) {
+				return false;
+			}
+		} else if (strncmp(arg, "--fuel=", 7) == 0) {
+			if (!parseSize(arg + 7, &options->fuel)) {
+				return false;
+			}
+		} else if (strcmp(arg, "--serve") == 0) {
+			options->isServe = true;
+		} else if (strncmp(arg, "--connect=", 10) == 0 && arg[10] != '\0') {
+			options->connectPath = arg + 10;
+		} else if (strncmp(arg, "--load=", 7) == 0) {
+			if (!parseSize(arg + 7, &options->requestCount)) {
+				return false;
+			}
+		} else if (strncmp(arg, "--cache-size=", 13) == 0) {
+			if (!parseSize(arg + 13, &options->cacheSize)) {
+				return false;
+			}
+		} else if (strncmp(arg, "--output-limit=", 15) == 0) {
+			if (!parseSize(arg + 15, &options->outputLimit)) {
+				return false;
+			}
+		} else if (strncmp(arg, "--threads=", 10) == 0) {
+			if (!parseSize(arg + 10, &options->threadCount)) {
+				return false;
+			}
+		} else if (strcmp(arg, "--unbuffered") == 0) {
+			options->isUnbuffered = true;
+		} else if (strncmp(arg, "--buffer-size=", 14) == 0) {
+			if (!parseSize(arg + 14, &options->bufferSize)) {
+				return false;
+			}
+		} else if (strncmp(arg, "--tape-size=", 12) == 0) {
+			if (!parseSize(arg + 12, &options->tapeSize)) {
+				return false;
+			}
+		} else if (strncmp(arg, "--engine=", 9) == 0) {
+			if (!parseEngine(arg + 9, &options->engine)) {
+				return false;
+			}
+		} else if (arg[0] != '-' && options->path == NULL) {
+			options->path = arg;
+		} else {
+			return false;
+		}
+	}
+	
+	// Batches and servers are only run with wrapping tapes because out of
+	// bounds memory accesses on bounded tapes exit the process.
+	if ((options->isBatch || options->isServe) && options->tapeSize != 0) {
+		return false;
+	}
+	
+	// Programs with a loop iteration limit are run with the metered VM, so they
+	// are not compiled to native code and cannot be profiled or measured by the
+	// instrumented VM.
+	if (options->fuel != 0) {
+		if (options->isProfile || options->isStats) {
+			return false;
+		}
+		
+		options->isJit = false;
+	}
+	
+	// Load tests are only run on servers.
+	if (options->requestCount != 0 && options->connectPath == NULL) {
+		return false;
+	}
+	
+	// Programs can only be transpiled, cached, profiled, measured, batched,
+	// served, or run on a server from a path.
+	return (!options->isEmitC && !options->isCompileOnly && !options->isProfile && !options->isStats && !options->isBatch && !options->isServe && options->connectPath == NULL) || options->path != NULL;
+}
+
+// Initialize a tape from options and return whether it could be allocated.
+static bool initOptionsTape(Tape *tape, const Options *options) {
+	if (!initTape(tape, options->tapeSize)) {
+		fprintf(stderr, "Could not allocate memory for the tape.\n");
+		return false;
+	}
+	
+	return true;
+}
+
+// Run an optional program with the JIT compiler and return an exit code.
+static int runJit(Node *program, const Options *options) {
+	if (program == NULL) {
+		return EXIT_FAILURE;
+	}
+	
+	Tape tape;
+	
+	if (!initOptionsTape(&tape, options)) {
+		freeProgram(program);
+		return EXIT_FAILURE;
+	}
+	
+	bool isRun = jitProgram(program, &tape, getStandardIO());
+	freeTape(&tape);
+	freeProgram(program);
+	
+	if (!isRun) {
+		fprintf(stderr, "Could not allocate memory for native code.\n");
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
+
+// Transpile an optional program to C on standard output and return an exit
+// code.
+static int emitC(Node *program, const Options *options) {
+	if (program == NULL) {
+		return EXIT_FAILURE;
+	}
+	
+	bool isTranspiled = transpileProgram(program, options->tapeSize, stdout);
+	freeProgram(program);
+	
+	if (!isTranspiled) {
+		fprintf(stderr, "Could not allocate memory for the tape.\n");
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
+
+// Run bytecode with the VM if it was compiled and return an exit code.
+static int runBytecode(bool isCompiled, Bytecode *bytecode, const Options *options) {
+	if (!isCompiled) {
+		return EXIT_FAILURE;
+	}
+	
+	Tape tape;
+	
+	if (!initOptionsTape(&tape, options)) {
+		freeBytecode(bytecode);
+		return EXIT_FAILURE;
+	}
+	
+	bool isHalted = true;
+	
+	// Programs with a loop iteration limit are run with the metered engine
+	// instead of the selected engine.
+	if (options->fuel == 0) {
+		interpretBytecode(bytecode->bytes, &tape, getStandardIO(), options->engine);
+	} else {
+		VMState state = {0, 0};
+		isHalted = meterBytecode(bytecode->bytes, &tape, getStandardIO(), &state, options->fuel);
+	}
+	
+	freeTape(&tape);
+	freeBytecode(bytecode);
+	
+	if (!isHalted) {
+		fprintf(stderr, "The program ran out of fuel.\n");
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
+
+// Profile a program from a path with the VM, print its profile to standard
+// error, and return an exit code.
+static int profile(const Options *options) {
+	Bytecode bytecode;
+	LoopTable loops;
+	
+	if (!compileProfiledPath(options->path, &bytecode, &loops)) {
+		return EXIT_FAILURE;
+	}
+	
+	Tape tape;
+	
+	if (!initOptionsTape(&tape, options)) {
+		freeLoopTable(&loops);
+		freeBytecode(&bytecode);
+		return EXIT_FAILURE;
+	}
+	
+	uint64_t *counts = (uint64_t*)calloc(bytecode.size, sizeof(uint64_t));
+	
+	if (counts == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	profileBytecode(bytecode.bytes, &tape, getStandardIO(), counts, NULL);
+	printProfile(bytecode.bytes, counts, &loops, stderr);
+	free(counts);
+	freeTape(&tape);
+	freeLoopTable(&loops);
+	freeBytecode(&bytecode);
+	return EXIT_SUCCESS;
+}
+
+// Run a program from a path with the VM, print statistics about compiling and
+// running it to standard error, and return an exit code.
+static int measure(const Options *options) {
+	Stats stats = {0};
+	Bytecode bytecode;
+	
+	if (!compileMeasuredPath(options->path, &bytecode, &stats)) {
+		return EXIT_FAILURE;
+	}
+	
+	Tape tape;
+	
+	if (!initOptionsTape(&tape, options)) {
+		freeBytecode(&bytecode);
+		return EXIT_FAILURE;
+	}
+	
+	uint64_t *counts = (uint64_t*)calloc(bytecode.size, sizeof(uint64_t));
+	
+	if (counts == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	PointerRange range;
+	uint64_t start = getClock();
+	profileBytecode(bytecode.bytes, &tape, getStandardIO(), counts, &range);
+	stats.phaseTimes[PHASE_EXECUTE] = getClock() - start;
+	
+	for (size_t i = 0; i < bytecode.size; i++) {
+		stats.instructionCount += counts[i];
+	}
+	
+	stats.lowestPointer = range.lowest;
+	stats.highestPointer = range.highest;
+	getIOCounts(getStandardIO(), &stats.inputCount, &stats.outputCount);
+	
+	if (options->isStatsJson) {
+		printStatsJson(&stats, stderr);
+	} else {
+		printStats(&stats, stderr);
+	}
+	
+	free(counts);
+	freeTape(&tape);
+	freeBytecode(&bytecode);
+	return EXIT_SUCCESS;
+}
+
 // Run a REPL and return an exit code.
-static int repl() {
+static int repl(const Options *options) {
 	printf("Brainiac REPL - Enter Brainfuck code or 'exit' to exit:\n\n");
 	char input[1024];
+	Bytecode bytecode;
 	
 	for (;;) {
 		printf("bf: ");
@@ -17,11 +427,10 @@ static int repl() {
 			return EXIT_SUCCESS;
 		}
 		
-		uint8_t *bytecode = compileSource(input);
-		
-		if (bytecode != NULL) {
-			interpretBytecode(bytecode);
-			free(bytecode);
+		if (options->isJit) {
+			runJit(optimizeSource(input), options);
+		} else {
+			runBytecode(compileSource(input, &bytecode), &bytecode, options);
 		}
 		
 		printf("\n");
@@ -29,26 +438,51 @@ static int repl() {
 }
 
 // Interpret a file from a source path and return an exit code.
-static int interpret(const char *path) {
-	uint8_t *bytecode = compilePath(path);
+static int interpret(const Options *options) {
+	Bytecode bytecode;
 	
-	if (bytecode == NULL) {
-		return EXIT_FAILURE;
+	if (options->isServe) {
+		return serve(options->path, options->threadCount, options->cacheSize, options->bufferSize, options->engine) ? EXIT_SUCCESS : EXIT_FAILURE;
+	} else if (options->requestCount != 0) {
+		return runLoadTest(options->connectPath, options->path, options->outputLimit, options->fuel, options->requestCount, options->threadCount) ? EXIT_SUCCESS : EXIT_FAILURE;
+	} else if (options->connectPath != NULL) {
+		return runClient(options->connectPath, options->path, options->outputLimit, options->fuel) ? EXIT_SUCCESS : EXIT_FAILURE;
+	} else if (options->isBatch) {
+		IOMode mode = options->isUnbuffered ? IO_UNBUFFERED : IO_FULL;
+		return runBatch(options->path, options->threadCount, mode, options->bufferSize, options->engine, options->sliceSize, options->residentLimit, options->fuel) ? EXIT_SUCCESS : EXIT_FAILURE;
+	} else if (options->isCompileOnly) {
+		return cachePath(options->path) ? EXIT_SUCCESS : EXIT_FAILURE;
+	} else if (options->isEmitC) {
+		return emitC(optimizePath(options->path), options);
+	} else if (options->isProfile) {
+		return profile(options);
+	} else if (options->isStats) {
+		return measure(options);
+	} else if (options->isJit) {
+		return runJit(optimizePath(options->path), options);
+	} else {
+		return runBytecode(compilePath(options->path, &bytecode), &bytecode, options);
 	}
-	
-	interpretBytecode(bytecode);
-	free(bytecode);
-	return EXIT_SUCCESS;
 }
 
 // Run Brainiac.
 int main(int argc, const char *argv[]) {
-	if (argc == 1) {
-		return repl();
-	} else if (argc == 2) {
-		return interpret(argv[1]);
-	} else {
-		fprintf(stderr, "Usage: brainiac [path]\n");
+	Options options;
+	
+	if (!parseOptions(&options, argc, argv)) {
+		fprintf(stderr, "Usage: brainiac [--jit] [--emit-c] [--compile-only] [--profile] [--stats[=json]] [--batch] [--slice=<iterations>] [--resident=<jobs>] [--fuel=<iterations>] [--serve] [--connect=<socket>] [--load=<requests>] [--threads=<count>] [--cache-size=<programs>] [--output-limit=<bytes>] [--unbuffered] [--buffer-size=<bytes>] [--tape-size=<cells>] [--engine=<engine>] [path]\n");
 		return EXIT_FAILURE;
 	}
+	
+	if (options.isUnbuffered) {
+		initIO(getStandardIO(), stdin, stdout, IO_UNBUFFERED, 1);
+	} else {
+		initIO(getStandardIO(), stdin, stdout, options.path == NULL ? IO_LINE : IO_FULL, options.bufferSize);
+	}
+	
+	if (options.path == NULL) {
+		return repl(&options);
+	} else {
+		return interpret(&options);
+	}
 }
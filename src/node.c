@@ -1,53 +1,92 @@
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "node.h"
 
-// Allocate a new node from its kind and value.
-Node *newNode(NodeKind kind, int value) {
-	Node *node = (Node*)malloc(sizeof(Node));
-	
-	if (node == NULL) {
-		exit(EXIT_FAILURE);
-	}
-	
+// Allocate a new node from an arena, its kind, and its value.
+Node *newNode(Arena *arena, NodeKind kind, int value) {
+	Node *node = (Node*)allocateArena(arena, sizeof(Node));
 	node->kind = kind;
 	node->value = value;
+	node->offset = 0;
+	node->data = NULL;
 	node->childCount = 0;
 	node->childCapacity = 0;
 	node->children = NULL;
+	node->arena = arena;
+	node->isOptimized = false;
+	node->position = 0;
 	return node;
 }
 
-// Free a node and its children.
-void freeNode(Node *node) {
-	for (int i = 0; i < node->childCount; i++) {
-		freeNode(node->children[i]);
-	}
-	
-	free(node->children);
-	free(node);
+// Free a program node and every node allocated from its arena.
+void freeProgram(Node *program) {
+	freeArena(program->arena);
+}
+
+// Copy data to a node's arena and set it as the node's data.
+void setNodeData(Node *node, const uint8_t *data, int size) {
+	node->data = (uint8_t*)allocateArena(node->arena, size);
+	memcpy(node->data, data, size);
+	node->value = size;
 }
 
 // Append a child node to a parent node.
 void appendNode(Node *parent, Node *child) {
+	// Outgrown child arrays are left in the arena. Their total size is less
+	// than the final array's size.
 	if (parent->childCount == parent->childCapacity) {
 		parent->childCapacity = parent->childCapacity != 0 ? parent->childCapacity * 2 : 1;
-		parent->children = (Node**)realloc(parent->children, parent->childCapacity * sizeof(Node*));
+		Node **children = (Node**)allocateArena(parent->arena, parent->childCapacity * sizeof(Node*));
 		
-		if (parent->children == NULL) {
-			exit(EXIT_FAILURE);
+		if (parent->childCount > 0) {
+			memcpy(children, parent->children, parent->childCount * sizeof(Node*));
 		}
+		
+		parent->children = children;
 	}
 	
 	parent->children[parent->childCount++] = child;
 }
 
-// Remove a child node from a parent node by index.
+// Remove a child node from a parent node by index without moving its other
+// children. The parent node must be compacted before its children are used.
 void removeNode(Node *parent, int index) {
-	freeNode(parent->children[index]);
-	parent->childCount--;
+	parent->children[index] = NULL;
+}
+
+// Compact a parent node's children after children have been removed.
+void compactNode(Node *parent) {
+	int childCount = 0;
 	
-	for (int i = index; i < parent->childCount; i++) {
-		parent->children[i] = parent->children[i + 1];
+	for (int i = 0; i < parent->childCount; i++) {
+		if (parent->children[i] != NULL) {
+			parent->children[childCount++] = parent->children[i];
+		}
 	}
+	
+	parent->childCount = childCount;
+}
+
+// Return the number of nodes in a tree from its root node.
+int countNodes(Node *node) {
+	int count = 1;
+	
+	for (int i = 0; i < node->childCount; i++) {
+		count += countNodes(node->children[i]);
+	}
+	
+	return count;
+}
+
+// Return whether a loop node runs at most once because it ends by setting its
+// pointed memory to 0.
+bool isLoopOnce(Node *loop) {
+	if (loop->childCount == 0) {
+		return false;
+	}
+	
+	Node *last = loop->children[loop->childCount - 1];
+	return last->kind == NODE_SET && last->offset == 0 && (uint8_t)last->value == 0;
 }
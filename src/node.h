@@ -1,6 +1,12 @@
 #ifndef BRAINIAC_NODE_H
 #define BRAINIAC_NODE_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
 // A node's kind.
 typedef enum {
 	NODE_PROGRAM, // A program composed of a sequence of commands.
@@ -10,6 +16,10 @@ typedef enum {
 	NODE_OUTPUT, // A '.' command.
 	NODE_INPUT, // A ',' command.
 	NODE_SET, // Set pointed memory.
+	NODE_MUL, // Add pointed memory multiplied by a factor to memory at an offset.
+	NODE_SCAN, // Move to the nearest zero memory by a stride.
+	NODE_REPEAT, // A balanced sequence repeated pointed memory times a factor times, then pointed memory set to 0.
+	NODE_WRITE, // Output a sequence of bytes.
 } NodeKind;
 
 // A node of a program.
@@ -20,26 +30,58 @@ typedef struct Node {
 	// The node's value.
 	int value;
 	
+	// The node's memory offset relative to the memory pointer.
+	int offset;
+	
+	// The node's data, or NULL if it has none. The node's value is the data's
+	// size in bytes.
+	uint8_t *data;
+	
 	// The node's child count.
 	int childCount;
 	
 	// The node's child capacity.
 	int childCapacity;
 	
-	// The node's children.
+	// The node's children. Removed children are NULL until the node is
+	// compacted.
 	struct Node **children;
+	
+	// The arena that the node and its children are allocated from.
+	Arena *arena;
+	
+	// Whether the node and its descendants are optimized.
+	bool isOptimized;
+	
+	// The offset of the node's '[' command in source code. Only loop and
+	// repeat nodes have positions.
+	size_t position;
 } Node;
 
-// Allocate a new node from its kind and value.
-Node *newNode(NodeKind kind, int value);
+// Allocate a new node from an arena, its kind, and its value.
+Node *newNode(Arena *arena, NodeKind kind, int value);
+
+// Free a program node and every node allocated from its arena.
+void freeProgram(Node *program);
 
-// Free a node and its children.
-void freeNode(Node *node);
+// Copy data to a node's arena and set it as the node's data.
+void setNodeData(Node *node, const uint8_t *data, int size);
 
 // Append a child node to a parent node.
 void appendNode(Node *parent, Node *child);
 
-// Remove a child node from a parent node by index.
+// Remove a child node from a parent node by index without moving its other
+// children. The parent node must be compacted before its children are used.
 void removeNode(Node *parent, int index);
 
+// Compact a parent node's children after children have been removed.
+void compactNode(Node *parent);
+
+// Return the number of nodes in a tree from its root node.
+int countNodes(Node *node);
+
+// Return whether a loop node runs at most once because it ends by setting its
+// pointed memory to 0.
+bool isLoopOnce(Node *loop);
+
 #endif // BRAINIAC_NODE_H
@@ -0,0 +1,64 @@
+#include "opcode.h"
+
+// Information about each opcode, generated from 'opcode.def'.
+static const OpcodeInfo opcodeInfos[OPCODE_COUNT] = {
+#define OPCODE(name, operands) \
+	[OP_##name] = {#name, OPERANDS_##operands, 1, {OP_##name}},
+#define SUPEROP2(name, first, second) \
+	[OP_##name] = {#name, OPERANDS_NONE, 2, {OP_##first, OP_##second}},
+#define SUPEROP3(name, first, second, third) \
+	[OP_##name] = {#name, OPERANDS_NONE, 3, {OP_##first, OP_##second, OP_##third}},
+#include "opcode.def"
+};
+
+// Get information about an opcode.
+const OpcodeInfo *getOpcodeInfo(Opcode opcode) {
+	return &opcodeInfos[opcode];
+}
+
+// Get the size of an operand layout in bytes.
+int getOperandsSize(Operands operands) {
+	switch (operands) {
+		case OPERANDS_NONE: return 0;
+		case OPERANDS_U8: return 1;
+		case OPERANDS_U16: return 2;
+		case OPERANDS_S16: return 2;
+		case OPERANDS_S16_U8: return 3;
+		case OPERANDS_BRZ_U8: return 1;
+		case OPERANDS_BRZ_U16: return 2;
+		case OPERANDS_BRZ_U32: return 4;
+		case OPERANDS_BNZ_U8: return 1;
+		case OPERANDS_BNZ_U16: return 2;
+		case OPERANDS_BNZ_U32: return 4;
+		case OPERANDS_DATA: return 8;
+	}
+	
+	return 0;
+}
+
+// Get whether an operand layout is a branch operand.
+bool isOperandsBranch(Operands operands) {
+	switch (operands) {
+		case OPERANDS_BRZ_U8:
+		case OPERANDS_BRZ_U16:
+		case OPERANDS_BRZ_U32:
+		case OPERANDS_BNZ_U8:
+		case OPERANDS_BNZ_U16:
+		case OPERANDS_BNZ_U32:
+			return true;
+		default:
+			return false;
+	}
+}
+
+// Get the size of an instruction in bytes from its opcode.
+int getInstructionSize(Opcode opcode) {
+	const OpcodeInfo *info = getOpcodeInfo(opcode);
+	int size = 1;
+	
+	for (int i = 0; i < info->length; i++) {
+		size += getOperandsSize(getOpcodeInfo(info->sequence[i])->operands);
+	}
+	
+	return size;
+}
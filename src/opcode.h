@@ -1,37 +1,63 @@
 #ifndef BRAINIAC_OPCODE_H
 #define BRAINIAC_OPCODE_H
 
-// A bytecode opcode.
+#include <stdbool.h>
+
+// The maximum number of opcodes in a superinstruction.
+#define OPCODE_MAX_SEQUENCE 3
+
+// A bytecode opcode. Opcodes are defined in 'opcode.def'.
 typedef enum {
-	OP_HLT, // Halt execution.
-	
-	OP_RGT, // Increment memory pointer.
-	OP_RGT_U8, // Increment memory pointer by U8 operand.
-	OP_RGT_U16, // Increment memory pointer by U16 operand.
-	
-	OP_LFT, // Decrement memory pointer.
-	OP_LFT_U8, // Decrement memory pointer by U8 operand.
-	OP_LFT_U16, // Decrement memory pointer by U16 operand.
-	
-	OP_INC, // Increment pointed memory.
-	OP_INC_U8, // Increment pointed memory by U8 operand.
-	
-	OP_DEC, // Decrement pointed memory.
-	OP_DEC_U8, // Decrement pointed memory by U8 operand.
-	
-	OP_OUT, // Output from pointed memory.
-	
-	OP_INP, // Input to pointed memory.
-	
-	OP_BRZ_U8, // Branch forward by U8 operand if pointed memory is zero.
-	OP_BRZ_U16, // Branch forward by U16 operand if pointed memory is zero.
-	
-	OP_BNZ_U8, // Branch backward by U8 operand if pointed memory is non-zero.
-	OP_BNZ_U16, // Branch backward by U16 operand if pointed memory is non-zero.
-	
-	OP_SET_0, // Set pointed memory to 0.
-	OP_SET_1, // Set pointed memory to 1.
-	OP_SET_U8, // Set pointed memory to U8 operand.
+#define OPCODE(name, operands) OP_##name,
+#define SUPEROP2(name, first, second) OP_##name,
+#define SUPEROP3(name, first, second, third) OP_##name,
+#include "opcode.def"
+	OPCODE_COUNT,
 } Opcode;
 
+// An opcode's operand layout.
+typedef enum {
+	OPERANDS_NONE, // No operands.
+	OPERANDS_U8, // U8 operand.
+	OPERANDS_U16, // U16 operand.
+	OPERANDS_S16, // S16 offset operand.
+	OPERANDS_S16_U8, // S16 offset operand and U8 operand.
+	OPERANDS_BRZ_U8, // U8 forward branch operand.
+	OPERANDS_BRZ_U16, // U16 forward branch operand.
+	OPERANDS_BRZ_U32, // U32 forward branch operand.
+	OPERANDS_BNZ_U8, // U8 backward branch operand.
+	OPERANDS_BNZ_U16, // U16 backward branch operand.
+	OPERANDS_BNZ_U32, // U32 backward branch operand.
+	OPERANDS_DATA, // U32 literal data offset operand from after itself and U32 size operand.
+} Operands;
+
+// Information about an opcode.
+typedef struct {
+	// The opcode's name.
+	const char *name;
+	
+	// The opcode's operand layout. Superinstructions use their sequence's
+	// operand layouts instead.
+	Operands operands;
+	
+	// The number of opcodes in the opcode's sequence.
+	int length;
+	
+	// The opcode's sequence. This is only the opcode unless the opcode is a
+	// superinstruction.
+	Opcode sequence[OPCODE_MAX_SEQUENCE];
+} OpcodeInfo;
+
+// Get information about an opcode.
+const OpcodeInfo *getOpcodeInfo(Opcode opcode);
+
+// Get the size of an operand layout in bytes.
+int getOperandsSize(Operands operands);
+
+// Get whether an operand layout is a branch operand.
+bool isOperandsBranch(Operands operands);
+
+// Get the size of an instruction in bytes from its opcode.
+int getInstructionSize(Opcode opcode);
+
 #endif // BRAINIAC_OPCODE_H
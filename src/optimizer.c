@@ -1,23 +1,149 @@
+#include <setjmp.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include "evaluator.h"
 #include "optimizer.h"
 
+// An optimization rule.
+typedef enum {
+	RULE_REMOVE_NOP, // Remove nodes that have no effect.
+	RULE_SINK_MOVES, // Sink move nodes to the end of a basic block.
+	RULE_REMOVE_HEAD_NOP, // Remove nodes that have no effect at the start of a program.
+	RULE_REMOVE_TAIL_NOP, // Remove nodes that have no effect at the end of a program.
+	RULE_REPLACE_HEAD_ADD_SET, // Replace an add node at the start of a program with a set node.
+	RULE_MERGE_NODES, // Merge a pair of nodes to a single node.
+	RULE_REMOVE_DEAD_LOOP, // Remove a loop node whose pointed memory is 0.
+	RULE_REPLACE_LOOP_SET, // Replace a loop node that sets to 0 with a set node.
+	RULE_REPLACE_LOOP_REPEAT, // Replace a loop node with a repeat node.
+	RULE_REPLACE_REPEAT_MUL, // Replace a repeat node with multiply and set nodes.
+	RULE_REPLACE_LOOP_SCAN, // Replace a loop node that only moves with a scan node.
+	RULE_REPLACE_LITERAL_OUTPUT, // Replace a run of nodes with literal output with a write node.
+	RULE_EVALUATE_PROGRAM_HEAD, // Evaluate the start of a program.
+	RULE_COUNT, // The number of optimization rules.
+} Rule;
+
+#ifdef BRAINIAC_DEBUG
+// The names of optimization rules by rule.
+static const char *const ruleNames[RULE_COUNT] = {
+	[RULE_REMOVE_NOP] = "Remove nop",
+	[RULE_SINK_MOVES] = "Sink moves",
+	[RULE_REMOVE_HEAD_NOP] = "Remove head nop",
+	[RULE_REMOVE_TAIL_NOP] = "Remove tail nop",
+	[RULE_REPLACE_HEAD_ADD_SET] = "Replace head add with set",
+	[RULE_MERGE_NODES] = "Merge nodes",
+	[RULE_REMOVE_DEAD_LOOP] = "Remove dead loop",
+	[RULE_REPLACE_LOOP_SET] = "Replace loop with set",
+	[RULE_REPLACE_LOOP_REPEAT] = "Replace loop with repeat",
+	[RULE_REPLACE_REPEAT_MUL] = "Replace repeat with multiply",
+	[RULE_REPLACE_LOOP_SCAN] = "Replace loop with scan",
+	[RULE_REPLACE_LITERAL_OUTPUT] = "Replace literal output",
+	[RULE_EVALUATE_PROGRAM_HEAD] = "Evaluate program head",
+};
+#endif // BRAINIAC_DEBUG
+
+// A memory cell changed by a run of nodes with literal output.
+typedef struct {
+	// The cell's memory offset.
+	int offset;
+	
+	// Whether the cell's value is known. Otherwise, the value is added to the
+	// cell's original value.
+	bool isKnown;
+	
+	// The cell's value.
+	uint8_t value;
+} LiteralCell;
+
+// A run of nodes with literal output.
+typedef struct {
+	// The number of output nodes in the run.
+	int outputNodeCount;
+	
+	// The number of output bytes.
+	int outputCount;
+	
+	// The output byte capacity.
+	int outputCapacity;
+	
+	// The output bytes.
+	uint8_t *output;
+	
+	// The number of changed memory cells.
+	int cellCount;
+	
+	// The changed memory cell capacity.
+	int cellCapacity;
+	
+	// The changed memory cells.
+	LiteralCell *cells;
+	
+	// The changed memory cells' indices plus 1, or 0 for unchanged memory
+	// cells, by their offsets modulo 65536.
+	int *cellIndices;
+	
+	// The number of nodes replacing a parent node's children.
+	int nodeCount;
+	
+	// The replacing node capacity.
+	int nodeCapacity;
+	
+	// The nodes replacing a parent node's children.
+	Node **nodes;
+	
+	// The arena of the program being optimized, which handles allocation
+	// failures.
+	Arena *arena;
+} LiteralRun;
+
+// Optimizes a program.
+typedef struct {
+	// Whether the children of the node being optimized have changed.
+	bool hasChanges;
+	
+	// The literal run shared by every node.
+	LiteralRun run;
+	
+	// The number of times the rules have been applied to a node.
+	int passCount;
+#ifdef BRAINIAC_DEBUG
+
+	// The number of times each rule has changed the program by rule.
+	int hitCounts[RULE_COUNT];
+#endif // BRAINIAC_DEBUG
+} Optimizer;
+
+// Record that a rule has changed the children of the node being optimized.
+static void hitRule(Optimizer *optimizer, Rule rule) {
+	optimizer->hasChanges = true;
+#ifdef BRAINIAC_DEBUG
+	optimizer->hitCounts[rule]++;
+#else // BRAINIAC_DEBUG
+	(void)rule;
+#endif // BRAINIAC_DEBUG
+}
+
 // Return whether a node has no effect.
 static bool isNodeNop(Node *node) {
 	switch (node->kind) {
-		case NODE_MOVE: return (int16_t)node->value == 0;
+		case NODE_MOVE: return node->value == 0;
 		case NODE_ADD: return (int8_t)node->value == 0;
+		case NODE_MUL: return (uint8_t)node->value == 0;
 		default: return false;
 	}
 }
 
-// Return whether a node has no effect at the start of a program.
+// Return whether a node has no effect at the start of a program, where all
+// memory is zero.
 static bool isNodeHeadNop(Node *node) {
 	switch (node->kind) {
 		case NODE_LOOP:
-		case NODE_MOVE:
+		case NODE_MUL:
+		case NODE_SCAN:
+		case NODE_REPEAT:
 			return true;
 		case NODE_ADD:
 			return (int8_t)node->value == 0;
@@ -34,36 +160,123 @@ static bool isNodeTailNop(Node *node) {
 		case NODE_MOVE:
 		case NODE_ADD:
 		case NODE_SET:
+		case NODE_MUL:
 			return true;
 		default:
 			return false;
 	}
 }
 
+// Return the multiplicative inverse of an odd value modulo 256.
+static uint8_t invertOdd(uint8_t value) {
+	uint8_t inverse = value; // Correct to 3 bits, doubled by each iteration.
+	
+	for (int i = 0; i < 2; i++) {
+		inverse *= 2 - value * inverse;
+	}
+	
+	return inverse;
+}
+
+// Return whether an offset can be encoded in an offset-addressed operation.
+static bool isOffsetInRange(int offset) {
+	return offset >= INT16_MIN && offset <= INT16_MAX;
+}
+
+// Return whether two positions relative to the memory pointer may be the same
+// memory on a wrapping tape.
+static bool isSamePosition(int first, int second) {
+	return ((first - second) & 0xffff) == 0;
+}
+
+// Return whether a node's children leave the memory pointer where it started
+// and never access memory at a position relative to it. If a step is given,
+// adding to the memory at the top level is counted in the step instead.
+static bool isBodyIndependent(Node *parent, int position, int *step) {
+	int pointer = 0;
+	
+	for (int i = 0; i < parent->childCount; i++) {
+		Node *child = parent->children[i];
+		
+		if (!isOffsetInRange(pointer)) {
+			return false;
+		}
+		
+		switch (child->kind) {
+			case NODE_MOVE:
+				pointer += child->value;
+				break;
+			case NODE_ADD:
+				if (step != NULL && isSamePosition(pointer + child->offset, position)) {
+					*step += child->value;
+					break;
+				}
+				
+				// Fall through.
+			case NODE_SET:
+			case NODE_OUTPUT:
+			case NODE_INPUT:
+				if (isSamePosition(pointer + child->offset, position)) {
+					return false;
+				}
+				
+				break;
+			case NODE_MUL:
+				if (isSamePosition(pointer, position) || isSamePosition(pointer + child->offset, position)) {
+					return false;
+				}
+				
+				break;
+			case NODE_LOOP:
+			case NODE_REPEAT:
+				if (isSamePosition(pointer, position) || !isBodyIndependent(child, position - pointer, NULL)) {
+					return false;
+				}
+				
+				break;
+			case NODE_WRITE:
+				break;
+			default:
+				return false;
+		}
+	}
+	
+	return pointer == 0;
+}
+
+// Allocate a new node from an arena, its kind, its value, and its offset.
+static Node *newOffsetNode(Arena *arena, NodeKind kind, int value, int offset) {
+	Node *node = newNode(arena, kind, value);
+	node->offset = offset;
+	return node;
+}
+
 // Merge a pair of nodes to a new single node.
 static Node *mergeNodes(Node *first, Node *second) {
+	Arena *arena = first->arena;
+	
 	switch (second->kind) {
-		case NODE_LOOP:
-			if (first->kind == NODE_SET && (uint8_t)first->value == 0) {
-				return newNode(NODE_SET, 0);
-			} else {
-				return NULL;
-			}
 		case NODE_MOVE:
 			if (first->kind == NODE_MOVE) {
-				return newNode(NODE_MOVE, first->value + second->value);
+				return newNode(arena, NODE_MOVE, first->value + second->value);
 			} else {
 				return NULL;
 			}
 		case NODE_ADD:
-			if (first->kind == NODE_ADD || first->kind == NODE_SET) {
-				return newNode(first->kind, first->value + second->value);
+			if ((first->kind == NODE_ADD || first->kind == NODE_SET) && first->offset == second->offset) {
+				return newOffsetNode(arena, first->kind, first->value + second->value, first->offset);
 			} else {
 				return NULL;
 			}
 		case NODE_SET:
-			if (first->kind == NODE_ADD || first->kind == NODE_SET) {
-				return newNode(NODE_SET, second->value);
+			if ((first->kind == NODE_ADD || first->kind == NODE_SET) && first->offset == second->offset) {
+				return newOffsetNode(arena, NODE_SET, second->value, second->offset);
+			} else {
+				return NULL;
+			}
+		case NODE_MUL:
+			if (first->kind == NODE_MUL && first->offset == second->offset) {
+				return newOffsetNode(arena, NODE_MUL, first->value + second->value, first->offset);
 			} else {
 				return NULL;
 			}
@@ -73,66 +286,162 @@ static Node *mergeNodes(Node *first, Node *second) {
 }
 
 // Remove nodes that have no effect.
-static void stepRemoveNop(Node *parent, bool *hasChanges) {
+static void stepRemoveNop(Optimizer *optimizer, Node *parent) {
+	bool hasRemoved = false;
+	
 	for (int i = parent->childCount - 1; i >= 0; i--) {
 		Node *child = parent->children[i];
-		stepRemoveNop(child, hasChanges);
 		
 		if (isNodeNop(child)) {
 			removeNode(parent, i);
-			*hasChanges = true;
+			hitRule(optimizer, RULE_REMOVE_NOP);
+			hasRemoved = true;
 		}
 	}
+	
+	if (hasRemoved) {
+		compactNode(parent);
+	}
+}
+
+// Return the index of the first node at the start of a program that is not a
+// move node. Moves at the start of a program are kept so that memory accesses
+// stay in bounds on bounded tapes.
+static int getHeadIndex(Node *program) {
+	int index = 0;
+	
+	while (index < program->childCount && program->children[index]->kind == NODE_MOVE) {
+		index++;
+	}
+	
+	return index;
 }
 
 // Remove nodes that have no effect at the start of a program.
-static void stepRemoveHeadNop(Node *parent, bool *hasChanges) {
-	while (parent->childCount > 0 && isNodeHeadNop(parent->children[0])) {
-		removeNode(parent, 0);
-		*hasChanges = true;
+static void stepRemoveHeadNop(Optimizer *optimizer, Node *parent) {
+	int index = getHeadIndex(parent);
+	bool hasRemoved = false;
+	
+	for (; index < parent->childCount && isNodeHeadNop(parent->children[index]); index++) {
+		removeNode(parent, index);
+		hitRule(optimizer, RULE_REMOVE_HEAD_NOP);
+		hasRemoved = true;
+	}
+	
+	if (hasRemoved) {
+		compactNode(parent);
 	}
 }
 
 // Remove nodes that have no effect at the end of a program.
-static void stepRemoveTailNop(Node *parent, bool *hasChanges) {
+static void stepRemoveTailNop(Optimizer *optimizer, Node *parent) {
 	while (parent->childCount > 0 && isNodeTailNop(parent->children[parent->childCount - 1])) {
-		removeNode(parent, parent->childCount - 1);
-		*hasChanges = true;
+		parent->childCount--;
+		hitRule(optimizer, RULE_REMOVE_TAIL_NOP);
 	}
 }
 
 // Replace add nodes at the start of a program with set nodes.
-static void stepReplaceHeadAddSet(Node *parent, bool *hasChanges) {
-	if (parent->childCount > 0 && parent->children[0]->kind == NODE_ADD) {
-		parent->children[0]->kind = NODE_SET;
-		*hasChanges = true;
+static void stepReplaceHeadAddSet(Optimizer *optimizer, Node *parent) {
+	int index = getHeadIndex(parent);
+	
+	if (index < parent->childCount && parent->children[index]->kind == NODE_ADD) {
+		parent->children[index]->kind = NODE_SET;
+		hitRule(optimizer, RULE_REPLACE_HEAD_ADD_SET);
 	}
 }
 
 // Merge pairs of nodes that can be represented as a single node.
-static void stepMergeNodes(Node *parent, bool *hasChanges) {
-	if (parent->childCount > 0) {
-		stepMergeNodes(parent->children[parent->childCount - 1], hasChanges);
+static void stepMergeNodes(Optimizer *optimizer, Node *parent) {
+	if (parent->childCount == 0) {
+		return;
 	}
 	
-	for (int i = parent->childCount - 2; i >= 0; i--) {
-		stepMergeNodes(parent->children[i], hasChanges);
-		Node *merged = mergeNodes(parent->children[i], parent->children[i + 1]);
+	// Merged nodes replace the first node of their pair and the second node
+	// is removed, so the next node is the nearest one that was not removed.
+	int next = parent->childCount - 1;
+	bool hasRemoved = false;
+	
+	for (int i = next - 1; i >= 0; i--) {
+		Node *merged = mergeNodes(parent->children[i], parent->children[next]);
 		
 		if (merged != NULL) {
-			removeNode(parent, i);
-			freeNode(parent->children[i]);
+			removeNode(parent, next);
 			parent->children[i] = merged;
-			*hasChanges = true;
+			hitRule(optimizer, RULE_MERGE_NODES);
+			hasRemoved = true;
+		}
+		
+		next = i;
+	}
+	
+	if (hasRemoved) {
+		compactNode(parent);
+	}
+}
+
+// Return whether a loop, scan, or repeat node in a parent node's children
+// starts with its pointed memory set to 0 by an earlier node in the same basic
+// block.
+static bool isLoopDead(Node *parent, int index) {
+	int position = 0;
+	
+	for (int i = index - 1; i >= 0; i--) {
+		Node *child = parent->children[i];
+		
+		switch (child->kind) {
+			case NODE_MOVE:
+				position += child->value;
+				break;
+			case NODE_SET:
+				if (child->offset == position) {
+					return (uint8_t)child->value == 0;
+				}
+				
+				// Fall through.
+			case NODE_ADD:
+			case NODE_INPUT:
+			case NODE_MUL:
+				if (isSamePosition(child->offset, position)) {
+					return false;
+				}
+				
+				break;
+			case NODE_OUTPUT:
+			case NODE_WRITE:
+				break;
+			default:
+				return false;
+		}
+	}
+	
+	return false;
+}
+
+// Remove loop, scan, and repeat nodes that start with their pointed memory set
+// to 0.
+static void stepRemoveDeadLoops(Optimizer *optimizer, Node *parent) {
+	bool hasRemoved = false;
+	
+	for (int i = parent->childCount - 1; i >= 0; i--) {
+		NodeKind kind = parent->children[i]->kind;
+		
+		if ((kind == NODE_LOOP || kind == NODE_SCAN || kind == NODE_REPEAT) && isLoopDead(parent, i)) {
+			removeNode(parent, i);
+			hitRule(optimizer, RULE_REMOVE_DEAD_LOOP);
+			hasRemoved = true;
 		}
 	}
+	
+	if (hasRemoved) {
+		compactNode(parent);
+	}
 }
 
 // Replace loop nodes that set to 0 with set nodes.
-static void stepReplaceLoopSet(Node *parent, bool *hasChanges) {
+static void stepReplaceLoopSet(Optimizer *optimizer, Node *parent) {
 	for (int i = 0; i < parent->childCount; i++) {
 		Node *loop = parent->children[i];
-		stepReplaceLoopSet(loop, hasChanges);
 		
 		if (loop->kind != NODE_LOOP || loop->childCount != 1) {
 			continue;
@@ -141,38 +450,525 @@ static void stepReplaceLoopSet(Node *parent, bool *hasChanges) {
 		Node *body = loop->children[0];
 		uint8_t value = (uint8_t)body->value;
 		
+		if (body->offset != 0) {
+			continue;
+		}
+		
 		if ((body->kind == NODE_ADD && (value & 1)) || (body->kind == NODE_SET && value == 0)) {
-			freeNode(loop);
-			parent->children[i] = newNode(NODE_SET, 0);
-			*hasChanges = true;
+			parent->children[i] = newNode(parent->arena, NODE_SET, 0);
+			hitRule(optimizer, RULE_REPLACE_LOOP_SET);
+		}
+	}
+}
+
+// Replace loop nodes with a provable trip count with repeat nodes.
+static void stepReplaceLoopRepeat(Optimizer *optimizer, Node *parent) {
+	for (int i = 0; i < parent->childCount; i++) {
+		Node *loop = parent->children[i];
+		int step = 0;
+		
+		if (loop->kind != NODE_LOOP || !isBodyIndependent(loop, 0, &step) || !(step & 1)) {
+			continue;
+		}
+		
+		// A balanced loop that only adds an odd step to its memory runs for the
+		// memory's value divided by the negated step iterations, modulo 256.
+		Node *repeat = newNode(parent->arena, NODE_REPEAT, invertOdd((uint8_t)-step));
+		repeat->position = loop->position;
+		int pointer = 0;
+		
+		for (int j = 0; j < loop->childCount; j++) {
+			Node *child = loop->children[j];
+			
+			if (child->kind == NODE_MOVE) {
+				pointer += child->value;
+			} else if (child->kind == NODE_ADD && isSamePosition(pointer + child->offset, 0)) {
+				continue;
+			}
+			
+			appendNode(repeat, child);
+		}
+		
+		parent->children[i] = repeat;
+		hitRule(optimizer, RULE_REPLACE_LOOP_REPEAT);
+	}
+}
+
+// Return whether a repeat node only adds to and sets memory, so it can be
+// replaced with multiply and set nodes.
+static bool isRepeatMul(Node *repeat) {
+	for (int i = 0; i < repeat->childCount; i++) {
+		NodeKind kind = repeat->children[i]->kind;
+		
+		if (kind != NODE_ADD && kind != NODE_SET) {
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+// Replace repeat nodes that only add to and set memory with multiply and set
+// nodes.
+static void stepReplaceRepeatMul(Optimizer *optimizer, Node *parent) {
+	for (int i = 0; i < parent->childCount; i++) {
+		Node *repeat = parent->children[i];
+		
+		if (repeat->kind != NODE_REPEAT || !isRepeatMul(repeat)) {
+			continue;
+		}
+		
+		// Memory that is set is the same after every iteration, and memory
+		// that is only added to gains its total addition times the trip count.
+		// The nodes stay in a loop that runs at most once, so memory that the
+		// original loop never accessed is not accessed when the pointed memory
+		// is zero.
+		Node *once = newNode(parent->arena, NODE_LOOP, 0);
+		once->position = repeat->position;
+		
+		for (int j = 0; j < repeat->childCount; j++) {
+			Node *child = repeat->children[j];
+			bool isSet = false;
+			bool isFirst = true;
+			int total = 0;
+			
+			for (int k = 0; k < repeat->childCount; k++) {
+				Node *other = repeat->children[k];
+				
+				if (other->offset == child->offset) {
+					isSet = isSet || other->kind == NODE_SET;
+					isFirst = isFirst && k >= j;
+					total += other->value;
+				}
+			}
+			
+			if (isSet) {
+				appendNode(once, newOffsetNode(parent->arena, child->kind, child->value, child->offset));
+			} else if (isFirst) {
+				appendNode(once, newOffsetNode(parent->arena, NODE_MUL, (uint8_t)(total * repeat->value), child->offset));
+			}
+		}
+		
+		appendNode(once, newNode(parent->arena, NODE_SET, 0));
+		parent->children[i] = once;
+		hitRule(optimizer, RULE_REPLACE_REPEAT_MUL);
+	}
+}
+
+// Replace loop nodes that only move with scan nodes.
+static void stepReplaceLoopScan(Optimizer *optimizer, Node *parent) {
+	for (int i = 0; i < parent->childCount; i++) {
+		Node *loop = parent->children[i];
+		
+		if (loop->kind != NODE_LOOP || loop->childCount != 1 || loop->children[0]->kind != NODE_MOVE) {
+			continue;
+		}
+		
+		int stride = loop->children[0]->value;
+		
+		if (stride != 0 && stride >= -UINT8_MAX && stride <= UINT8_MAX) {
+			parent->children[i] = newNode(parent->arena, NODE_SCAN, stride);
+			hitRule(optimizer, RULE_REPLACE_LOOP_SCAN);
+		}
+	}
+}
+
+// Sink move nodes to the end of each basic block by giving the nodes before
+// them memory offsets.
+static void stepSinkMoves(Optimizer *optimizer, Node *parent) {
+	// The children are rewritten in place. A sunk move node is only written
+	// after the move nodes that it replaces have been read.
+	Node **children = parent->children;
+	int childCount = parent->childCount;
+	parent->childCount = 0;
+	int offset = 0;
+	int moveCount = 0;
+	
+	for (int i = 0; i < childCount; i++) {
+		Node *child = children[i];
+		
+		switch (child->kind) {
+			case NODE_MOVE:
+				offset += child->value;
+				moveCount++;
+				continue;
+			case NODE_WRITE:
+				if (moveCount > 0) {
+					hitRule(optimizer, RULE_SINK_MOVES);
+				}
+				
+				appendNode(parent, child);
+				continue;
+			case NODE_ADD:
+			case NODE_SET:
+			case NODE_OUTPUT:
+			case NODE_INPUT:
+				if (isOffsetInRange(child->offset + offset)) {
+					if (offset != 0) {
+						child->offset += offset;
+						hitRule(optimizer, RULE_SINK_MOVES);
+					}
+					
+					appendNode(parent, child);
+					continue;
+				}
+				
+				break;
+			default:
+				break;
+		}
+		
+		if (moveCount > 0) {
+			appendNode(parent, newNode(parent->arena, NODE_MOVE, offset));
+			
+			if (moveCount > 1) {
+				hitRule(optimizer, RULE_SINK_MOVES);
+			}
+			
+			offset = 0;
+			moveCount = 0;
+		}
+		
+		appendNode(parent, child);
+	}
+	
+	if (moveCount > 0) {
+		appendNode(parent, newNode(parent->arena, NODE_MOVE, offset));
+		
+		if (moveCount > 1) {
+			hitRule(optimizer, RULE_SINK_MOVES);
+		}
+	}
+}
+
+// Find a changed memory cell in a literal run by its offset, or NULL if it has
+// not been changed.
+static LiteralCell *findLiteralCell(LiteralRun *run, int offset) {
+	int index = run->cellIndices[(uint16_t)offset];
+	return index != 0 ? &run->cells[index - 1] : NULL;
+}
+
+// Get a changed memory cell in a literal run by its offset, starting a new
+// unchanged cell if it has not been changed.
+static LiteralCell *getLiteralCell(LiteralRun *run, int offset) {
+	LiteralCell *cell = findLiteralCell(run, offset);
+	
+	if (cell != NULL) {
+		return cell;
+	}
+	
+	if (run->cellCount == run->cellCapacity) {
+		run->cellCapacity = run->cellCapacity != 0 ? run->cellCapacity * 2 : 8;
+		LiteralCell *cells = (LiteralCell*)realloc(run->cells, run->cellCapacity * sizeof(LiteralCell));
+		
+		if (cells == NULL) {
+			failArena(run->arena);
+		}
+		
+		run->cells = cells;
+	}
+	
+	run->cellIndices[(uint16_t)offset] = run->cellCount + 1;
+	cell = &run->cells[run->cellCount++];
+	cell->offset = offset;
+	cell->isKnown = false;
+	cell->value = 0;
+	return cell;
+}
+
+// Forget the changed memory cells in a literal run after a number of cells.
+static void truncateLiteralCells(LiteralRun *run, int cellCount) {
+	for (int i = cellCount; i < run->cellCount; i++) {
+		run->cellIndices[(uint16_t)run->cells[i].offset] = 0;
+	}
+	
+	run->cellCount = cellCount;
+}
+
+// Append output bytes to a literal run.
+static void appendLiteralOutput(LiteralRun *run, const uint8_t *bytes, int count) {
+	if (run->outputCount + count > run->outputCapacity) {
+		while (run->outputCount + count > run->outputCapacity) {
+			run->outputCapacity = run->outputCapacity != 0 ? run->outputCapacity * 2 : 64;
+		}
+		
+		uint8_t *output = (uint8_t*)realloc(run->output, run->outputCapacity * sizeof(uint8_t));
+		
+		if (output == NULL) {
+			failArena(run->arena);
+		}
+		
+		run->output = output;
+	}
+	
+	memcpy(run->output + run->outputCount, bytes, count);
+	run->outputCount += count;
+	run->outputNodeCount++;
+}
+
+// Append a node to the nodes replacing a parent node's children.
+static void appendReplacingNode(LiteralRun *run, Node *node) {
+	if (run->nodeCount == run->nodeCapacity) {
+		run->nodeCapacity = run->nodeCapacity != 0 ? run->nodeCapacity * 2 : 64;
+		Node **nodes = (Node**)realloc(run->nodes, run->nodeCapacity * sizeof(Node*));
+		
+		if (nodes == NULL) {
+			failArena(run->arena);
 		}
+		
+		run->nodes = nodes;
+	}
+	
+	run->nodes[run->nodeCount++] = node;
+}
+
+// Append a node to a literal run and return whether its effect is known.
+static bool appendLiteralNode(LiteralRun *run, Node *node);
+
+// Append a loop node to a literal run and return whether its effect is known.
+// The run is unchanged if the loop's effect is not known.
+static bool appendLiteralLoop(LiteralRun *run, Node *loop) {
+	LiteralCell *cell = findLiteralCell(run, 0);
+	
+	if (!isLoopOnce(loop) || cell == NULL || !cell->isKnown) {
+		return false;
+	} else if (cell->value == 0) {
+		return true;
+	}
+	
+	// Loops that run once without moving are evaluated in place. The run's
+	// cells are saved in case the loop's body is not known.
+	LiteralRun saved = *run;
+	saved.cells = (LiteralCell*)malloc(run->cellCount * sizeof(LiteralCell) + 1);
+	
+	if (saved.cells == NULL) {
+		failArena(run->arena);
+	}
+	
+	// The saved cells are freed before passing on allocation failures from
+	// evaluating the loop.
+	jmp_buf recovery;
+	jmp_buf *previous = setArenaRecovery(run->arena, &recovery);
+	
+	if (setjmp(recovery) != 0) {
+		free(saved.cells);
+		setArenaRecovery(run->arena, previous);
+		failArena(run->arena);
+	}
+	
+	memcpy(saved.cells, run->cells, run->cellCount * sizeof(LiteralCell));
+	bool isKnown = true;
+	
+	for (int i = 0; i < loop->childCount && isKnown; i++) {
+		Node *child = loop->children[i];
+		isKnown = child->kind != NODE_MOVE && appendLiteralNode(run, child);
+	}
+	
+	if (!isKnown) {
+		truncateLiteralCells(run, saved.cellCount);
+		memcpy(run->cells, saved.cells, saved.cellCount * sizeof(LiteralCell));
+		run->outputCount = saved.outputCount;
+		run->outputNodeCount = saved.outputNodeCount;
+	}
+	
+	setArenaRecovery(run->arena, previous);
+	free(saved.cells);
+	return isKnown;
+}
+
+// Append a node to a literal run and return whether its effect is known.
+static bool appendLiteralNode(LiteralRun *run, Node *node) {
+	LiteralCell *cell;
+	
+	switch (node->kind) {
+		case NODE_SET:
+			cell = getLiteralCell(run, node->offset);
+			cell->isKnown = true;
+			cell->value = (uint8_t)node->value;
+			return true;
+		case NODE_ADD:
+			cell = getLiteralCell(run, node->offset);
+			cell->value += (uint8_t)node->value;
+			return true;
+		case NODE_MUL:
+			cell = findLiteralCell(run, 0);
+			
+			if (cell == NULL || !cell->isKnown) {
+				return false;
+			}
+			
+			uint8_t value = cell->value;
+			getLiteralCell(run, node->offset)->value += (uint8_t)(value * node->value);
+			return true;
+		case NODE_OUTPUT:
+			cell = findLiteralCell(run, node->offset);
+			
+			if (cell == NULL || !cell->isKnown) {
+				return false;
+			}
+			
+			appendLiteralOutput(run, &cell->value, 1);
+			return true;
+		case NODE_WRITE:
+			appendLiteralOutput(run, node->data, node->value);
+			return true;
+		case NODE_LOOP:
+			return appendLiteralLoop(run, node);
+		default:
+			return false;
 	}
 }
 
-// Run an optimization pass and return whether any changes were made.
-static bool runPass(Node *program) {
-	bool hasChanges = false;
-	stepRemoveNop(program, &hasChanges);
-	stepRemoveHeadNop(program, &hasChanges);
-	stepRemoveTailNop(program, &hasChanges);
-	stepReplaceHeadAddSet(program, &hasChanges);
-	stepMergeNodes(program, &hasChanges);
-	stepReplaceLoopSet(program, &hasChanges);
-	return hasChanges;
+// Replace runs of nodes that output known memory with write nodes followed by
+// the final state of the memory they change.
+static void stepReplaceLiteralOutput(Optimizer *optimizer, Node *parent) {
+	LiteralRun *run = &optimizer->run;
+	Node **children = parent->children;
+	int childCount = parent->childCount;
+	bool hasReplaced = false;
+	int start = 0;
+	run->nodeCount = 0;
+	
+	for (int i = 0; i <= childCount; i++) {
+		if (i < childCount && appendLiteralNode(run, children[i])) {
+			continue;
+		}
+		
+		// A run is only replaced if it combines multiple output nodes.
+		if (run->outputNodeCount > 1) {
+			Node *write = newNode(parent->arena, NODE_WRITE, 0);
+			setNodeData(write, run->output, run->outputCount);
+			appendReplacingNode(run, write);
+			
+			for (int j = 0; j < run->cellCount; j++) {
+				LiteralCell *cell = &run->cells[j];
+				appendReplacingNode(run, newOffsetNode(parent->arena, cell->isKnown ? NODE_SET : NODE_ADD, cell->value, cell->offset));
+			}
+			
+			hitRule(optimizer, RULE_REPLACE_LITERAL_OUTPUT);
+			hasReplaced = true;
+		} else {
+			for (int j = start; j < i; j++) {
+				appendReplacingNode(run, children[j]);
+			}
+		}
+		
+		if (i < childCount) {
+			appendReplacingNode(run, children[i]);
+		}
+		
+		run->outputNodeCount = 0;
+		run->outputCount = 0;
+		truncateLiteralCells(run, 0);
+		start = i + 1;
+	}
+	
+	if (!hasReplaced) {
+		return;
+	}
+	
+	// Replacing nodes can outnumber the nodes they replace, so the children
+	// are only rewritten in place if they fit.
+	if (run->nodeCount > parent->childCapacity) {
+		parent->childCapacity = run->nodeCount;
+		parent->children = (Node**)allocateArena(parent->arena, parent->childCapacity * sizeof(Node*));
+	}
+	
+	memcpy(parent->children, run->nodes, run->nodeCount * sizeof(Node*));
+	parent->childCount = run->nodeCount;
 }
 
-// Optimize a program.
-void optimizeProgram(Node *program) {
-	bool shouldOptimize = true;
-	int passCount = 0;
+// Apply each rule once to a node's children.
+static void applyRules(Optimizer *optimizer, Node *parent) {
+	stepRemoveNop(optimizer, parent);
+	stepSinkMoves(optimizer, parent);
+	
+	if (parent->kind == NODE_PROGRAM) {
+		stepRemoveHeadNop(optimizer, parent);
+		stepRemoveTailNop(optimizer, parent);
+		stepReplaceHeadAddSet(optimizer, parent);
+	}
 	
-	while (shouldOptimize) {
-		shouldOptimize = runPass(program);
-		passCount++;
+	stepMergeNodes(optimizer, parent);
+	stepRemoveDeadLoops(optimizer, parent);
+	stepReplaceLoopSet(optimizer, parent);
+	stepReplaceLoopRepeat(optimizer, parent);
+	stepReplaceRepeatMul(optimizer, parent);
+	stepReplaceLoopScan(optimizer, parent);
+	stepReplaceLiteralOutput(optimizer, parent);
+}
+
+// Optimize a node that is not optimized and its descendants until they stop
+// changing.
+static void optimizeNode(Optimizer *optimizer, Node *node) {
+	// Rules only change the children of the node they are applied to, and
+	// they only depend on the children and descendants of that node. New nodes
+	// are not optimized, so after a change only the new children are optimized
+	// before the rules are applied to the node again.
+	while (!node->isOptimized) {
+		node->isOptimized = true;
+		
+		for (int i = 0; i < node->childCount; i++) {
+			optimizeNode(optimizer, node->children[i]);
+		}
 		
-		if (passCount >= 256) {
-			fprintf(stderr, "Possible infinite loop in optimizer.\n");
+		if (node->childCount == 0) {
 			break;
 		}
+		
+		optimizer->hasChanges = false;
+		applyRules(optimizer, node);
+		optimizer->passCount++;
+		node->isOptimized = !optimizer->hasChanges;
 	}
 }
+
+// Optimize a program with an optimizer and return whether memory could be
+// allocated.
+static bool runOptimizer(Optimizer *optimizer, Node *program) {
+	jmp_buf recovery;
+	jmp_buf *previous = setArenaRecovery(program->arena, &recovery);
+	
+	if (setjmp(recovery) != 0) {
+		setArenaRecovery(program->arena, previous);
+		return false;
+	}
+	
+	optimizeNode(optimizer, program);
+	
+	if (evaluateProgramHead(program)) {
+		hitRule(optimizer, RULE_EVALUATE_PROGRAM_HEAD);
+		program->isOptimized = false;
+		optimizeNode(optimizer, program);
+	}
+	
+	setArenaRecovery(program->arena, previous);
+	return true;
+}
+
+// Optimize a program and return the number of times the rules were applied to
+// a node, or -1 if memory could not be allocated.
+int optimizeProgram(Node *program) {
+	Optimizer optimizer = {0};
+	optimizer.run.arena = program->arena;
+	optimizer.run.cellIndices = (int*)calloc(UINT16_MAX + 1, sizeof(int));
+	
+	if (optimizer.run.cellIndices == NULL) {
+		return -1;
+	}
+	
+	bool isOptimized = runOptimizer(&optimizer, program);
+	free(optimizer.run.cellIndices);
+	free(optimizer.run.cells);
+	free(optimizer.run.output);
+	free(optimizer.run.nodes);
+#ifdef BRAINIAC_DEBUG
+	printf("\nOptimizer rule hits:\n");
+	
+	for (int i = 0; i < RULE_COUNT; i++) {
+		printf("%s: %d\n", ruleNames[i], optimizer.hitCounts[i]);
+	}
+#endif // BRAINIAC_DEBUG
+
+	return isOptimized ? optimizer.passCount : -1;
+}
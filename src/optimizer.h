@@ -3,7 +3,8 @@
 
 #include "node.h"
 
-// Optimize a program.
-void optimizeProgram(Node *program);
+// Optimize a program and return the number of times the rules were applied to
+// a node, or -1 if memory could not be allocated.
+int optimizeProgram(Node *program);
 
 #endif // BRAINIAC_OPTIMIZER_H
@@ -1,4 +1,6 @@
+#include <setjmp.h>
 #include <stdbool.h>
+#include <stdio.h>
 
 #include "parser.h"
 
@@ -10,26 +12,26 @@ typedef struct {
 	// The parser's next token.
 	Token next;
 	
-	// The parser's current line number.
-	int line;
+	// The position of the parser's current token. Line and column numbers are
+	// only found from positions when errors are logged.
+	const char *position;
 	
-	// The parser's current column number.
-	int column;
+	// The arena that the parser's nodes are allocated from.
+	Arena *arena;
 } Parser;
 
 // Initialize a parser.
 static void initParser(Parser *parser, Scanner *scanner) {
 	parser->scanner = scanner;
 	parser->next = scanToken(scanner);
-	parser->line = 1;
-	parser->column = 1;
+	parser->position = scanner->start;
+	parser->arena = NULL;
 }
 
 // Advance to the next token.
 static Token advance(Parser *parser) {
 	Token current = parser->next;
-	parser->line = parser->scanner->line;
-	parser->column = parser->scanner->column;
+	parser->position = parser->scanner->current;
 	parser->next = scanToken(parser->scanner);
 	return current;
 }
@@ -49,14 +51,17 @@ static bool accept(Parser *parser, Token kind) {
 	}
 }
 
-// Log an error message at a line and column number.
-static void logErrorAt(int line, int column, const char *message) {
+// Log an error message at a position's line and column number.
+static void logErrorAt(Parser *parser, const char *position, const char *message) {
+	int line;
+	int column;
+	getScannerPosition(parser->scanner, position, &line, &column);
 	fprintf(stderr, "[%d:%d] %s\n", line, column, message);
 }
 
 // Log an error message at the current line and column number.
 static void logError(Parser *parser, const char *message) {
-	logErrorAt(parser->line, parser->column, message);
+	logErrorAt(parser, parser->position, message);
 }
 
 // Parse a sequence.
@@ -71,7 +76,7 @@ static Node *parseSequence(Parser *parser, NodeKind kind, Token neg, Token pos,
 		}
 	}
 	
-	return newNode(kind, value);
+	return newNode(parser->arena, kind, value);
 }
 
 // Parse a command.
@@ -79,10 +84,9 @@ static Node *parseCommand(Parser *parser);
 
 // Parse a loop.
 static Node *parseLoop(Parser *parser) {
-	int line = parser->line;
-	int column = parser->column;
+	const char *position = parser->position;
 	bool hasError = false;
-	Node *loop = newNode(NODE_LOOP, 0);
+	Node *loop = newNode(parser->arena, NODE_LOOP, 0);
 	
 	while (!match(parser, TOKEN_RBRACKET) && !match(parser, TOKEN_EOF)) {
 		Node *command = parseCommand(parser);
@@ -95,13 +99,14 @@ static Node *parseLoop(Parser *parser) {
 		appendNode(loop, command);
 	}
 	
+	loop->position = (size_t)(position - parser->scanner->start);
+	
 	if (!accept(parser, TOKEN_RBRACKET)) {
-		logErrorAt(line, column, "Cannot use '[' without a matching closing ']'.");
+		logErrorAt(parser, position, "Cannot use '[' without a matching closing ']'.");
 		hasError = true;
 	}
 	
 	if (hasError) {
-		freeNode(loop);
 		return NULL;
 	}
 	
@@ -123,9 +128,9 @@ static Node *parseCommand(Parser *parser) {
 		case TOKEN_MINUS:
 			return parseSequence(parser, NODE_ADD, TOKEN_MINUS, TOKEN_PLUS, -1);
 		case TOKEN_DOT:
-			return newNode(NODE_OUTPUT, 0);
+			return newNode(parser->arena, NODE_OUTPUT, 0);
 		case TOKEN_COMMA:
-			return newNode(NODE_INPUT, 0);
+			return newNode(parser->arena, NODE_INPUT, 0);
 		case TOKEN_LBRACKET:
 			return parseLoop(parser);
 		case TOKEN_RBRACKET:
@@ -136,10 +141,25 @@ static Node *parseCommand(Parser *parser) {
 	return NULL;
 }
 
-// Parse a program.
+// Parse a program, or return NULL if memory could not be allocated.
 static Node *parseProgram(Parser *parser) {
+	Arena *arena = newArena();
+	
+	if (arena == NULL) {
+		return NULL;
+	}
+	
+	jmp_buf recovery;
+	
+	if (setjmp(recovery) != 0) {
+		freeArena(arena);
+		return NULL;
+	}
+	
+	setArenaRecovery(arena, &recovery);
+	parser->arena = arena;
 	bool hasError = false;
-	Node *program = newNode(NODE_PROGRAM, 0);
+	Node *program = newNode(arena, NODE_PROGRAM, 0);
 	
 	while (!match(parser, TOKEN_EOF)) {
 		Node *command = parseCommand(parser);
@@ -152,15 +172,18 @@ static Node *parseProgram(Parser *parser) {
 		appendNode(program, command);
 	}
 	
+	setArenaRecovery(arena, NULL);
+	
 	if (hasError) {
-		freeNode(program);
+		freeProgram(program);
 		return NULL;
 	}
 	
 	return program;
 }
 
-// Parse a program from a scanner.
+// Parse a program from a scanner, or return NULL if it has syntax errors or
+// memory could not be allocated.
 Node *parseScanner(Scanner *scanner) {
 	Parser parser;
 	initParser(&parser, scanner);
@@ -4,7 +4,8 @@
 #include "node.h"
 #include "scanner.h"
 
-// Parse a program from a scanner.
+// Parse a program from a scanner, or return NULL if it has syntax errors or
+// memory could not be allocated.
 Node *parseScanner(Scanner *scanner);
 
 #endif // BRAINIAC_PARSER_H
@@ -0,0 +1,124 @@
+#include <stdlib.h>
+
+#include "opcode.h"
+#include "profiler.h"
+
+// The maximum number of loops printed in a profile.
+#define PROFILE_MAX_LOOPS 10
+
+// A counted entry in a profile.
+typedef struct {
+	// The entry's number of instructions dispatched.
+	uint64_t count;
+	
+	// The entry's loop index or opcode.
+	int index;
+} ProfileEntry;
+
+// Compare profile entries by descending count and then ascending index.
+static int compareEntries(const void *first, const void *second) {
+	const ProfileEntry *a = (const ProfileEntry*)first;
+	const ProfileEntry *b = (const ProfileEntry*)second;
+	
+	if (a->count != b->count) {
+		return a->count < b->count ? 1 : -1;
+	}
+	
+	return (a->index > b->index) - (a->index < b->index);
+}
+
+// Get a percentage of a total count.
+static double getPercentage(uint64_t count, uint64_t total) {
+	return total != 0 ? 100.0 * (double)count / (double)total : 0.0;
+}
+
+// Get the size of bytecode's instructions in bytes, excluding literal data
+// after its HLT opcode.
+static int getCodeSize(const uint8_t *bytecode) {
+	int size = 0;
+	Opcode opcode;
+	
+	do {
+		opcode = (Opcode)bytecode[size];
+		size += getInstructionSize(opcode);
+	} while (opcode != OP_HLT);
+	
+	return size;
+}
+
+// Print the loops that dispatched the most instructions, including the
+// instructions of nested loops.
+static void printLoops(const uint64_t *counts, int size, const LoopTable *loops, uint64_t total, FILE *file) {
+	// Each loop's instructions are summed from the total instructions
+	// dispatched before each address.
+	uint64_t *totals = (uint64_t*)malloc((size + 1) * sizeof(uint64_t));
+	ProfileEntry *entries = (ProfileEntry*)malloc((loops->count + 1) * sizeof(ProfileEntry));
+	
+	if (totals == NULL || entries == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	totals[0] = 0;
+	
+	for (int i = 0; i < size; i++) {
+		totals[i + 1] = totals[i] + counts[i];
+	}
+	
+	for (int i = 0; i < loops->count; i++) {
+		const LoopPosition *loop = &loops->loops[i];
+		entries[i].count = totals[loop->end] - totals[loop->start];
+		entries[i].index = i;
+	}
+	
+	qsort(entries, loops->count, sizeof(ProfileEntry), compareEntries);
+	fprintf(file, "\nHottest loops:\n");
+	fprintf(file, "%-24s %16s %8s %16s\n", "Source", "Instructions", "Share", "Entries");
+	
+	for (int i = 0; i < loops->count && i < PROFILE_MAX_LOOPS && entries[i].count != 0; i++) {
+		const LoopPosition *loop = &loops->loops[entries[i].index];
+		char source[32];
+		snprintf(source, sizeof(source), "%d:%d", loop->line, loop->column);
+		fprintf(file, "%-24s %16llu %7.2f%% %16llu\n", source, (unsigned long long)entries[i].count, getPercentage(entries[i].count, total), (unsigned long long)counts[loop->start]);
+	}
+	
+	free(entries);
+	free(totals);
+}
+
+// Print the number of instructions dispatched for each opcode.
+static void printOpcodes(const uint8_t *bytecode, const uint64_t *counts, int size, uint64_t total, FILE *file) {
+	ProfileEntry entries[OPCODE_COUNT];
+	
+	for (int i = 0; i < OPCODE_COUNT; i++) {
+		entries[i].count = 0;
+		entries[i].index = i;
+	}
+	
+	for (int address = 0; address < size; address += getInstructionSize((Opcode)bytecode[address])) {
+		entries[bytecode[address]].count += counts[address];
+	}
+	
+	qsort(entries, OPCODE_COUNT, sizeof(ProfileEntry), compareEntries);
+	fprintf(file, "\nOpcode histogram:\n");
+	fprintf(file, "%-24s %16s %8s\n", "Opcode", "Instructions", "Share");
+	
+	for (int i = 0; i < OPCODE_COUNT && entries[i].count != 0; i++) {
+		fprintf(file, "%-24s %16llu %7.2f%%\n", getOpcodeInfo((Opcode)entries[i].index)->name, (unsigned long long)entries[i].count, getPercentage(entries[i].count, total));
+	}
+}
+
+// Print a profile of bytecode to a file from the number of instructions
+// dispatched at each address and the bytecode's loop table.
+void printProfile(const uint8_t *bytecode, const uint64_t *counts, const LoopTable *loops, FILE *file) {
+	int size = getCodeSize(bytecode);
+	uint64_t total = 0;
+	
+	for (int i = 0; i < size; i++) {
+		total += counts[i];
+	}
+	
+	fprintf(file, "\nProfile:\n");
+	fprintf(file, "Dispatched %llu instructions.\n", (unsigned long long)total);
+	printLoops(counts, size, loops, total, file);
+	printOpcodes(bytecode, counts, size, total, file);
+}
@@ -0,0 +1,13 @@
+#ifndef BRAINIAC_PROFILER_H
+#define BRAINIAC_PROFILER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "generator.h"
+
+// Print a profile of bytecode to a file from the number of instructions
+// dispatched at each address and the bytecode's loop table.
+void printProfile(const uint8_t *bytecode, const uint64_t *counts, const LoopTable *loops, FILE *file);
+
+#endif // BRAINIAC_PROFILER_H
@@ -0,0 +1,151 @@
+#define _GNU_SOURCE
+
+#include <string.h>
+
+#include "scan.h"
+
+#if defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#define SCAN_SIMD_WIDTH 32
+#elif defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define SCAN_SIMD_WIDTH 16
+#endif
+
+#ifdef SCAN_SIMD_WIDTH
+// Return a mask of zero cells in a block of memory.
+static uint32_t getZeroMask(const uint8_t *block) {
+#if SCAN_SIMD_WIDTH == 32
+	__m256i cells = _mm256_loadu_si256((const __m256i*)block);
+	return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(cells, _mm256_setzero_si256()));
+#else // SCAN_SIMD_WIDTH == 32
+	__m128i cells = _mm_loadu_si128((const __m128i*)block);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(cells, _mm_setzero_si128()));
+#endif // SCAN_SIMD_WIDTH == 32
+}
+
+// Return a mask of every stride-th cell in a block of memory, starting from the
+// first cell.
+static uint32_t getStrideMask(size_t stride) {
+	uint32_t mask = 0;
+	
+	for (size_t i = 0; i < SCAN_SIMD_WIDTH; i += stride) {
+		mask |= (uint32_t)1 << i;
+	}
+	
+	return mask;
+}
+#endif // SCAN_SIMD_WIDTH
+
+// Return the index of the first zero cell of memory at or right of an index by
+// multiples of a stride and before an end index. Return SIZE_MAX if there is
+// no such cell.
+static size_t scanRightSpan(const uint8_t *memory, size_t index, size_t end, size_t stride) {
+	if (stride == 1) {
+		const uint8_t *zero = (const uint8_t*)memchr(memory + index, 0, end - index);
+		return zero != NULL ? (size_t)(zero - memory) : SIZE_MAX;
+	}
+#ifdef SCAN_SIMD_WIDTH
+	if (SCAN_SIMD_WIDTH % stride == 0) {
+		uint32_t strideMask = getStrideMask(stride);
+		
+		for (; end - index >= SCAN_SIMD_WIDTH; index += SCAN_SIMD_WIDTH) {
+			uint32_t mask = getZeroMask(memory + index) & strideMask;
+			
+			if (mask != 0) {
+				return index + (size_t)__builtin_ctz(mask);
+			}
+		}
+	}
+#endif // SCAN_SIMD_WIDTH
+	for (; index < end; index += stride) {
+		if (memory[index] == 0) {
+			return index;
+		}
+	}
+	
+	return SIZE_MAX;
+}
+
+// Return the index of the first zero cell of memory at or left of an index by
+// multiples of a stride. Return SIZE_MAX if there is no such cell.
+static size_t scanLeftSpan(const uint8_t *memory, size_t index, size_t stride) {
+#ifdef __GLIBC__
+	if (stride == 1) {
+		const uint8_t *zero = (const uint8_t*)memrchr(memory, 0, index + 1);
+		return zero != NULL ? (size_t)(zero - memory) : SIZE_MAX;
+	}
+#endif // __GLIBC__
+#ifdef SCAN_SIMD_WIDTH
+	if (SCAN_SIMD_WIDTH % stride == 0) {
+		// Align the stride mask to the last cell of each block.
+		uint32_t strideMask = getStrideMask(stride) << (stride - 1);
+		
+		while (index >= SCAN_SIMD_WIDTH - 1) {
+			size_t start = index - (SCAN_SIMD_WIDTH - 1);
+			uint32_t mask = getZeroMask(memory + start) & strideMask;
+			
+			if (mask != 0) {
+				return start + (size_t)(31 - __builtin_clz(mask));
+			}
+			
+			if (start == 0) {
+				return SIZE_MAX;
+			}
+			
+			index -= SCAN_SIMD_WIDTH;
+		}
+	}
+#endif // SCAN_SIMD_WIDTH
+	for (;;) {
+		if (memory[index] == 0) {
+			return index;
+		}
+		
+		if (index < stride) {
+			return SIZE_MAX;
+		}
+		
+		index -= stride;
+	}
+}
+
+// Return the index of the nearest zero cell of optionally wrapping memory at or
+// right of an index by multiples of a stride. Return the memory's size if there
+// is no such cell.
+size_t scanRight(const uint8_t *memory, size_t size, size_t index, size_t stride, bool isWrapping) {
+	// After the first pass, every pass starts before the stride, so every
+	// reachable cell has been visited after one more pass than the stride.
+	size_t passCount = isWrapping ? stride + 1 : 1;
+	
+	for (size_t pass = 0; pass < passCount; pass++) {
+		size_t zero = scanRightSpan(memory, index, size, stride);
+		
+		if (zero != SIZE_MAX) {
+			return zero;
+		}
+		
+		index += (size - 1 - index) / stride * stride + stride - size;
+	}
+	
+	return size;
+}
+
+// Return the index of the nearest zero cell of optionally wrapping memory at or
+// left of an index by multiples of a stride. Return the memory's size if there
+// is no such cell.
+size_t scanLeft(const uint8_t *memory, size_t size, size_t index, size_t stride, bool isWrapping) {
+	size_t passCount = isWrapping ? stride + 1 : 1;
+	
+	for (size_t pass = 0; pass < passCount; pass++) {
+		size_t zero = scanLeftSpan(memory, index, stride);
+		
+		if (zero != SIZE_MAX) {
+			return zero;
+		}
+		
+		index = index % stride + size - stride;
+	}
+	
+	return size;
+}
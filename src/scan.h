@@ -0,0 +1,18 @@
+#ifndef BRAINIAC_SCAN_H
+#define BRAINIAC_SCAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Return the index of the nearest zero cell of optionally wrapping memory at or
+// right of an index by multiples of a stride. Return the memory's size if there
+// is no such cell.
+size_t scanRight(const uint8_t *memory, size_t size, size_t index, size_t stride, bool isWrapping);
+
+// Return the index of the nearest zero cell of optionally wrapping memory at or
+// left of an index by multiples of a stride. Return the memory's size if there
+// is no such cell.
+size_t scanLeft(const uint8_t *memory, size_t size, size_t index, size_t stride, bool isWrapping);
+
+#endif // BRAINIAC_SCAN_H
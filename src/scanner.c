@@ -1,74 +1,132 @@
+#include <stdint.h>
+
 #include "scanner.h"
 
-// Initialize a scanner's position.
-static void initScannerPosition(Scanner *scanner) {
-	scanner->line = 1;
-	scanner->column = 1;
-	scanner->nextLine = 1;
-	scanner->nextColumn = 1;
-}
+#if defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#define SCANNER_SIMD_WIDTH 32
+#elif defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define SCANNER_SIMD_WIDTH 16
+#endif
 
-// Initialize a scanner from a file.
-void initScannerFile(Scanner *scanner, FILE *file) {
-	scanner->file = file;
-	scanner->next = NULL;
-	initScannerPosition(scanner);
+#ifdef SCANNER_SIMD_WIDTH
+// Return a mask of command characters in a block of source code.
+static uint32_t getCommandMask(const char *block) {
+#if SCANNER_SIMD_WIDTH == 32
+	__m256i bytes = _mm256_loadu_si256((const __m256i*)block);
+	
+	// '+', ',', '-', and '.' are consecutive, so they are found by range.
+	__m256i range = _mm256_sub_epi8(bytes, _mm256_set1_epi8('+'));
+	__m256i mask = _mm256_cmpeq_epi8(_mm256_min_epu8(range, _mm256_set1_epi8(3)), range);
+	mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('<')));
+	mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('>')));
+	mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('[')));
+	mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(']')));
+	return (uint32_t)_mm256_movemask_epi8(mask);
+#else // SCANNER_SIMD_WIDTH == 32
+	__m128i bytes = _mm_loadu_si128((const __m128i*)block);
+	
+	// '+', ',', '-', and '.' are consecutive, so they are found by range.
+	__m128i range = _mm_sub_epi8(bytes, _mm_set1_epi8('+'));
+	__m128i mask = _mm_cmpeq_epi8(_mm_min_epu8(range, _mm_set1_epi8(3)), range);
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('<')));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('>')));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('[')));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(']')));
+	return (uint32_t)_mm_movemask_epi8(mask);
+#endif // SCANNER_SIMD_WIDTH == 32
 }
+#endif // SCANNER_SIMD_WIDTH
 
-// Initialize a scanner from source code.
-void initScannerSource(Scanner *scanner, const char *source) {
-	scanner->file = NULL;
+// Initialize a scanner from source code and its size in bytes.
+void initScanner(Scanner *scanner, const char *source, size_t size) {
+	scanner->start = source;
+	scanner->end = source + size;
 	scanner->next = source;
-	initScannerPosition(scanner);
+	scanner->current = source;
+	scanner->counted = source;
+	scanner->countedLine = 1;
+	scanner->countedColumn = 1;
 }
 
-// Advance to the next character.
-static int advance(Scanner *scanner) {
-	if (scanner->file != NULL) {
-		return fgetc(scanner->file);
+// Skip to the next command character or the end of source code.
+static void skipComments(Scanner *scanner) {
+#ifdef SCANNER_SIMD_WIDTH
+	// Comments are skipped in blocks until a block contains a command.
+	while (scanner->end - scanner->next >= SCANNER_SIMD_WIDTH) {
+		uint32_t mask = getCommandMask(scanner->next);
+		
+		if (mask != 0) {
+			scanner->next += __builtin_ctz(mask);
+			return;
+		}
+		
+		scanner->next += SCANNER_SIMD_WIDTH;
 	}
-	
-	char current = *scanner->next++;
-	
-	if (current == '\0') {
-		return EOF;
+#endif // SCANNER_SIMD_WIDTH
+	for (; scanner->next < scanner->end; scanner->next++) {
+		switch (*scanner->next) {
+			case '+':
+			case ',':
+			case '-':
+			case '.':
+			case '<':
+			case '>':
+			case '[':
+			case ']':
+				return;
+		}
 	}
-	
-	return (int)(unsigned char)current;
 }
 
 // Scan the next token.
 Token scanToken(Scanner *scanner) {
-	for (;;) {
-		scanner->line = scanner->nextLine;
-		scanner->column = scanner->nextColumn++;
-		
-		switch (advance(scanner)) {
-			case EOF:
-				return TOKEN_EOF;
+	skipComments(scanner);
+	scanner->current = scanner->next;
+	
+	if (scanner->next == scanner->end) {
+		return TOKEN_EOF;
+	}
+	
+	switch (*scanner->next++) {
+		case '+': return TOKEN_PLUS;
+		case ',': return TOKEN_COMMA;
+		case '-': return TOKEN_MINUS;
+		case '.': return TOKEN_DOT;
+		case '<': return TOKEN_LESS;
+		case '>': return TOKEN_GREATER;
+		case '[': return TOKEN_LBRACKET;
+		default: return TOKEN_RBRACKET;
+	}
+}
+
+// Get the line and column numbers of a position in a scanner's source code.
+void getScannerPosition(Scanner *scanner, const char *position, int *line, int *column) {
+	// Positions are usually found in order, so counting continues from the last
+	// counted position when possible.
+	if (position < scanner->counted) {
+		scanner->counted = scanner->start;
+		scanner->countedLine = 1;
+		scanner->countedColumn = 1;
+	}
+	
+	for (; scanner->counted < position; scanner->counted++) {
+		switch (*scanner->counted) {
 			case '\t':
-				scanner->nextColumn += 3 - ((scanner->nextColumn - 2) & 3);
+				scanner->countedColumn++;
+				scanner->countedColumn += 3 - ((scanner->countedColumn - 2) & 3);
 				break;
 			case '\n':
-				scanner->nextLine++;
-				scanner->nextColumn = 1;
+				scanner->countedLine++;
+				scanner->countedColumn = 1;
+				break;
+			default:
+				scanner->countedColumn++;
 				break;
-			case '+':
-				return TOKEN_PLUS;
-			case ',':
-				return TOKEN_COMMA;
-			case '-':
-				return TOKEN_MINUS;
-			case '.':
-				return TOKEN_DOT;
-			case '<':
-				return TOKEN_LESS;
-			case '>':
-				return TOKEN_GREATER;
-			case '[':
-				return TOKEN_LBRACKET;
-			case ']':
-				return TOKEN_RBRACKET;
 		}
 	}
+	
+	*line = scanner->countedLine;
+	*column = scanner->countedColumn;
 }
@@ -1,7 +1,7 @@
 #ifndef BRAINIAC_SCANNER_H
 #define BRAINIAC_SCANNER_H
 
-#include <stdio.h>
+#include <stddef.h>
 
 // A syntactic element of source code.
 typedef enum {
@@ -18,32 +18,35 @@ typedef enum {
 
 // Scans tokens from source code.
 typedef struct {
-	// The scanner's file.
-	FILE *file;
+	// The start of the scanner's source code.
+	const char *start;
+	
+	// The end of the scanner's source code.
+	const char *end;
 	
 	// The scanner's next character.
 	const char *next;
 	
-	// The scanner's current line number.
-	int line;
+	// The position of the scanner's current token.
+	const char *current;
 	
-	// The scanner's current column number.
-	int column;
+	// The last position that line and column numbers were found for.
+	const char *counted;
 	
-	// The scanner's next line number.
-	int nextLine;
+	// The line number of the last counted position.
+	int countedLine;
 	
-	// The scanner's next column number.
-	int nextColumn;
+	// The column number of the last counted position.
+	int countedColumn;
 } Scanner;
 
-// Initialize a scanner from a file.
-void initScannerFile(Scanner *scanner, FILE *file);
-
-// Initialize a scanner from source code.
-void initScannerSource(Scanner *scanner, const char *source);
+// Initialize a scanner from source code and its size in bytes.
+void initScanner(Scanner *scanner, const char *source, size_t size);
 
 // Scan the next token.
 Token scanToken(Scanner *scanner);
 
+// Get the line and column numbers of a position in a scanner's source code.
+void getScannerPosition(Scanner *scanner, const char *position, int *line, int *column);
+
 #endif // BRAINIAC_SCANNER_H
@@ -0,0 +1,335 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif // _WIN32
+
+#include "scheduler.h"
+
+// A worker's queue of started tasks. Workers take tasks from the front of
+// their own queue and steal them from the back of other queues.
+typedef struct {
+	// The queued task indices in a ring buffer.
+	int *tasks;
+	
+	// The ring buffer's capacity in tasks.
+	int capacity;
+	
+	// The index of the front task in the ring buffer.
+	int front;
+	
+	// The number of queued tasks.
+	int count;
+#ifndef _WIN32
+
+	// The lock for the queue.
+	pthread_mutex_t lock;
+#endif // _WIN32
+} TaskQueue;
+
+// A scheduler that runs tasks in slices on worker threads.
+typedef struct {
+	// The function that runs a slice of a task.
+	SchedulerSlice *slice;
+	
+	// The context passed to the slice function.
+	void *context;
+	
+	// The number of tasks.
+	int taskCount;
+	
+	// The index of the next task to start.
+	int nextTask;
+	
+	// The number of started tasks that have not finished.
+	int residentCount;
+	
+	// The maximum number of started tasks that have not finished.
+	int residentLimit;
+	
+	// The number of finished tasks.
+	int finishedCount;
+	
+	// The number of tasks in every queue.
+	int queuedCount;
+	
+	// The number of worker threads.
+	int workerCount;
+	
+	// Each worker's queue.
+	TaskQueue *queues;
+#ifndef _WIN32
+
+	// The lock for the scheduler's counts.
+	pthread_mutex_t lock;
+	
+	// The condition signaled when a task is queued or may be started, or when
+	// every task has finished.
+	pthread_cond_t wake;
+#endif // _WIN32
+} Scheduler;
+
+// A worker thread's scheduler and queue index.
+typedef struct {
+	// The worker's scheduler.
+	Scheduler *scheduler;
+	
+	// The index of the worker's queue.
+	int index;
+} SchedulerWorker;
+
+// Lock a scheduler's counts.
+static void lockScheduler(Scheduler *scheduler) {
+#ifndef _WIN32
+	pthread_mutex_lock(&scheduler->lock);
+#else // _WIN32
+	(void)scheduler;
+#endif // _WIN32
+}
+
+// Unlock a scheduler's counts.
+static void unlockScheduler(Scheduler *scheduler) {
+#ifndef _WIN32
+	pthread_mutex_unlock(&scheduler->lock);
+#else // _WIN32
+	(void)scheduler;
+#endif // _WIN32
+}
+
+// Wake a scheduler's waiting workers. The scheduler's counts must be locked.
+static void wakeWorkers(Scheduler *scheduler) {
+#ifndef _WIN32
+	pthread_cond_broadcast(&scheduler->wake);
+#else // _WIN32
+	(void)scheduler;
+#endif // _WIN32
+}
+
+// Lock a task queue.
+static void lockQueue(TaskQueue *queue) {
+#ifndef _WIN32
+	pthread_mutex_lock(&queue->lock);
+#else // _WIN32
+	(void)queue;
+#endif // _WIN32
+}
+
+// Unlock a task queue.
+static void unlockQueue(TaskQueue *queue) {
+#ifndef _WIN32
+	pthread_mutex_unlock(&queue->lock);
+#else // _WIN32
+	(void)queue;
+#endif // _WIN32
+}
+
+// Push a task to the back of a worker's queue. The queue's task is counted
+// after it is pushed, so the count may briefly be negative while the task is
+// popped by another worker.
+static void pushTask(Scheduler *scheduler, int worker, int task) {
+	TaskQueue *queue = &scheduler->queues[worker];
+	lockQueue(queue);
+	queue->tasks[(queue->front + queue->count++) % queue->capacity] = task;
+	unlockQueue(queue);
+	lockScheduler(scheduler);
+	scheduler->queuedCount++;
+	wakeWorkers(scheduler);
+	unlockScheduler(scheduler);
+}
+
+// Pop a task from the front or back of a worker's queue and return it, or -1 if
+// the queue is empty.
+static int popTask(Scheduler *scheduler, int worker, bool isFront) {
+	TaskQueue *queue = &scheduler->queues[worker];
+	int task = -1;
+	lockQueue(queue);
+	
+	if (queue->count > 0) {
+		if (isFront) {
+			task = queue->tasks[queue->front];
+			queue->front = (queue->front + 1) % queue->capacity;
+		} else {
+			task = queue->tasks[(queue->front + queue->count - 1) % queue->capacity];
+		}
+		
+		queue->count--;
+	}
+	
+	unlockQueue(queue);
+	
+	if (task >= 0) {
+		lockScheduler(scheduler);
+		scheduler->queuedCount--;
+		unlockScheduler(scheduler);
+	}
+	
+	return task;
+}
+
+// Start the next task and return it, or -1 if every task has started or the
+// resident limit has been reached.
+static int startTask(Scheduler *scheduler) {
+	int task = -1;
+	lockScheduler(scheduler);
+	
+	if (scheduler->nextTask < scheduler->taskCount && scheduler->residentCount < scheduler->residentLimit) {
+		task = scheduler->nextTask++;
+		scheduler->residentCount++;
+	}
+	
+	unlockScheduler(scheduler);
+	return task;
+}
+
+// Steal a task from the back of another worker's queue and return it, or -1 if
+// every other queue is empty.
+static int stealTask(Scheduler *scheduler, int worker) {
+	for (int i = 1; i < scheduler->workerCount; i++) {
+		int task = popTask(scheduler, (worker + i) % scheduler->workerCount, false);
+		
+		if (task >= 0) {
+			return task;
+		}
+	}
+	
+	return -1;
+}
+
+// Wait until a task may be queued or started and return whether any tasks
+// have not finished.
+static bool waitForTask(Scheduler *scheduler) {
+	lockScheduler(scheduler);
+#ifndef _WIN32
+	while (scheduler->queuedCount <= 0 && scheduler->finishedCount < scheduler->taskCount && (scheduler->nextTask == scheduler->taskCount || scheduler->residentCount == scheduler->residentLimit)) {
+		pthread_cond_wait(&scheduler->wake, &scheduler->lock);
+	}
+#endif // _WIN32
+	bool isUnfinished = scheduler->finishedCount < scheduler->taskCount;
+	unlockScheduler(scheduler);
+	return isUnfinished;
+}
+
+// Run slices of a scheduler's tasks on a worker thread until every task has
+// finished.
+static void *runSchedulerWorker(void *argument) {
+	SchedulerWorker *worker = (SchedulerWorker*)argument;
+	Scheduler *scheduler = worker->scheduler;
+	
+	for (;;) {
+		// New tasks are started before queued tasks are resumed so that short
+		// tasks are not held back by long tasks.
+		int task = startTask(scheduler);
+		
+		if (task < 0) {
+			task = popTask(scheduler, worker->index, true);
+		}
+		
+		if (task < 0) {
+			task = stealTask(scheduler, worker->index);
+		}
+		
+		if (task < 0) {
+			if (!waitForTask(scheduler)) {
+				return NULL;
+			}
+			
+			continue;
+		}
+		
+		if (!scheduler->slice(scheduler->context, task)) {
+			pushTask(scheduler, worker->index, task);
+			continue;
+		}
+		
+		lockScheduler(scheduler);
+		scheduler->residentCount--;
+		scheduler->finishedCount++;
+		wakeWorkers(scheduler);
+		unlockScheduler(scheduler);
+	}
+}
+
+// Run a number of tasks in slices on a number of worker threads until every
+// task has finished.
+void runScheduler(int taskCount, int threadCount, int residentLimit, SchedulerSlice *slice, void *context) {
+	Scheduler scheduler;
+	scheduler.slice = slice;
+	scheduler.context = context;
+	scheduler.taskCount = taskCount;
+	scheduler.nextTask = 0;
+	scheduler.residentCount = 0;
+	scheduler.residentLimit = residentLimit > 0 ? residentLimit : 1;
+	scheduler.finishedCount = 0;
+	scheduler.queuedCount = 0;
+#ifndef _WIN32
+	scheduler.workerCount = threadCount > 0 ? threadCount : 1;
+#else // _WIN32
+	(void)threadCount;
+	scheduler.workerCount = 1;
+#endif // _WIN32
+	scheduler.queues = (TaskQueue*)malloc(scheduler.workerCount * sizeof(TaskQueue));
+	SchedulerWorker *workers = (SchedulerWorker*)malloc(scheduler.workerCount * sizeof(SchedulerWorker));
+	
+	if (scheduler.queues == NULL || workers == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	// Only resident tasks are queued, so no queue holds more tasks than the
+	// resident limit.
+	for (int i = 0; i < scheduler.workerCount; i++) {
+		TaskQueue *queue = &scheduler.queues[i];
+		queue->tasks = (int*)malloc(scheduler.residentLimit * sizeof(int));
+		queue->capacity = scheduler.residentLimit;
+		queue->front = 0;
+		queue->count = 0;
+		
+		if (queue->tasks == NULL) {
+			exit(EXIT_FAILURE);
+		}
+#ifndef _WIN32
+		pthread_mutex_init(&queue->lock, NULL);
+#endif // _WIN32
+		workers[i].scheduler = &scheduler;
+		workers[i].index = i;
+	}
+#ifndef _WIN32
+	pthread_mutex_init(&scheduler.lock, NULL);
+	pthread_cond_init(&scheduler.wake, NULL);
+	pthread_t *threads = (pthread_t*)malloc(scheduler.workerCount * sizeof(pthread_t));
+	
+	if (threads == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	// The calling thread is the first worker.
+	int startedCount = 1;
+	
+	while (startedCount < scheduler.workerCount && pthread_create(&threads[startedCount], NULL, runSchedulerWorker, &workers[startedCount]) == 0) {
+		startedCount++;
+	}
+	
+	runSchedulerWorker(&workers[0]);
+	
+	for (int i = 1; i < startedCount; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	
+	free(threads);
+	pthread_cond_destroy(&scheduler.wake);
+	pthread_mutex_destroy(&scheduler.lock);
+#else // _WIN32
+	runSchedulerWorker(&workers[0]);
+#endif // _WIN32
+
+	for (int i = 0; i < scheduler.workerCount; i++) {
+#ifndef _WIN32
+		pthread_mutex_destroy(&scheduler.queues[i].lock);
+#endif // _WIN32
+		free(scheduler.queues[i].tasks);
+	}
+	
+	free(workers);
+	free(scheduler.queues);
+}
@@ -0,0 +1,18 @@
+#ifndef BRAINIAC_SCHEDULER_H
+#define BRAINIAC_SCHEDULER_H
+
+#include <stdbool.h>
+
+// Run a slice of a task with a context and return whether the task finished.
+// A task's slices are never run at the same time, but may be run by different
+// threads.
+typedef bool SchedulerSlice(void *context, int task);
+
+// Run a number of tasks in slices on a number of worker threads until every
+// task has finished. Tasks are started in order, and at most a resident limit
+// of tasks are started but not finished at once. Each worker runs the tasks in
+// its own queue in turn and steals tasks from other workers' queues when its
+// own queue is empty, so long tasks share the workers fairly with short tasks.
+void runScheduler(int taskCount, int threadCount, int residentLimit, SchedulerSlice *slice, void *context);
+
+#endif // BRAINIAC_SCHEDULER_H
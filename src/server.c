@@ -0,0 +1,752 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "cache.h"
+#include "compiler.h"
+#include "server.h"
+#include "socket.h"
+
+#ifndef _WIN32
+// The maximum number of connections with requests waiting for a worker thread.
+#define SERVER_QUEUE_CAPACITY 256
+
+// A program compiled by a server and shared by the requests running it.
+typedef struct {
+	// The cache key of the program's source code.
+	CacheKey key;
+	
+	// The program's bytecode.
+	Bytecode bytecode;
+	
+	// The number of references to the program, including the cache's
+	// reference while it is cached. The program is freed when this reaches 0.
+	int referenceCount;
+	
+	// The server's use count when the program was last used.
+	uint64_t lastUse;
+} ServedProgram;
+
+// A server that runs programs from requests on a Unix domain socket.
+typedef struct {
+	// The listening socket.
+	int socket;
+	
+	// The number of cached programs.
+	int programCount;
+	
+	// The cached program capacity.
+	int programCapacity;
+	
+	// The cached programs.
+	ServedProgram **programs;
+	
+	// The number of times cached programs have been used.
+	uint64_t useCount;
+	
+	// The output buffer size for each request in bytes.
+	size_t bufferSize;
+	
+	// The engine that runs each request's bytecode.
+	Engine engine;
+	
+	// The lock for the cached programs.
+	pthread_mutex_t lock;
+	
+	// The connections with a request waiting for a worker thread, in a ring
+	// buffer.
+	int queuedClients[SERVER_QUEUE_CAPACITY];
+	
+	// The index of the front connection in the ring buffer.
+	int queueFront;
+	
+	// The number of connections with a request waiting for a worker thread.
+	int queueCount;
+	
+	// The number of connections that finished a request and are waiting to be
+	// polled again.
+	int idleCount;
+	
+	// The capacity of the idle connections.
+	int idleCapacity;
+	
+	// The connections that finished a request and are waiting to be polled
+	// again.
+	int *idleClients;
+	
+	// Whether the server has stopped polling for requests.
+	bool isStopped;
+	
+	// The pipe that wakes the polling thread when idle connections are
+	// returned.
+	int wakePipe[2];
+	
+	// The lock for the queued and idle connections.
+	pthread_mutex_t queueLock;
+	
+	// The condition signaled when a connection is queued or the server stops.
+	pthread_cond_t queued;
+	
+	// The condition signaled when a queued connection is taken.
+	pthread_cond_t taken;
+} Server;
+
+// A request being run by a worker thread.
+typedef struct {
+	// The client's socket.
+	int socket;
+	
+	// The request's kind.
+	RequestKind kind;
+	
+	// The cache key of the program's source code.
+	CacheKey key;
+	
+	// The program's source code, or NULL if the program was requested by its
+	// cache key.
+	char *source;
+	
+	// The maximum number of bytes to output, or 0 for no limit.
+	uint64_t outputLimit;
+	
+	// The maximum number of loop iterations, or 0 for no limit.
+	uint64_t fuel;
+	
+	// The request's input size in bytes.
+	size_t inputSize;
+	
+	// The index of the next input byte to read.
+	size_t inputNext;
+	
+	// The request's input bytes.
+	uint8_t *input;
+	
+	// The number of bytes output.
+	uint64_t outputCount;
+	
+	// The response's status.
+	ResponseStatus status;
+	
+	// Whether the client disconnected while output was being sent.
+	bool isDisconnected;
+	
+	// The state to jump to when the program is stopped early.
+	jmp_buf stop;
+} ServedRequest;
+
+// Release a reference to a served program and free it if it has no more
+// references. The server's lock must be held.
+static void releaseProgram(ServedProgram *program) {
+	if (--program->referenceCount == 0) {
+		freeBytecode(&program->bytecode);
+		free(program);
+	}
+}
+
+// Return whether a program matches a cache key. Cache keys contain a digest of
+// the source code, so programs with the same key have the same source code.
+static bool isProgramMatch(const ServedProgram *program, const CacheKey *key) {
+	return program->key.size == key->size && memcmp(program->key.digest, key->digest, DIGEST_SIZE) == 0;
+}
+
+// Find a cached program from a cache key and return a new reference to it, or
+// NULL if it is not cached.
+static ServedProgram *findProgram(Server *server, const CacheKey *key) {
+	ServedProgram *found = NULL;
+	pthread_mutex_lock(&server->lock);
+	
+	for (int i = 0; i < server->programCount; i++) {
+		ServedProgram *program = server->programs[i];
+		
+		if (isProgramMatch(program, key)) {
+			program->referenceCount++;
+			program->lastUse = ++server->useCount;
+			found = program;
+			break;
+		}
+	}
+	
+	pthread_mutex_unlock(&server->lock);
+	return found;
+}
+
+// Cache a new program with one reference, evicting the least recently used
+// program if the cache is full. Return a reference to the cached program,
+// which replaces the new program if another thread cached it first.
+static ServedProgram *cacheProgram(Server *server, ServedProgram *program) {
+	pthread_mutex_lock(&server->lock);
+	int leastIndex = 0;
+	
+	for (int i = 0; i < server->programCount; i++) {
+		ServedProgram *cached = server->programs[i];
+		
+		if (isProgramMatch(cached, &program->key)) {
+			releaseProgram(program);
+			cached->referenceCount++;
+			cached->lastUse = ++server->useCount;
+			pthread_mutex_unlock(&server->lock);
+			return cached;
+		}
+		
+		if (cached->lastUse < server->programs[leastIndex]->lastUse) {
+			leastIndex = i;
+		}
+	}
+	
+	// Evicted programs are freed once the requests running them release them.
+	if (server->programCount == server->programCapacity) {
+		releaseProgram(server->programs[leastIndex]);
+		server->programs[leastIndex] = server->programs[--server->programCount];
+	}
+	
+	program->referenceCount++;
+	program->lastUse = ++server->useCount;
+	server->programs[server->programCount++] = program;
+	pthread_mutex_unlock(&server->lock);
+	return program;
+}
+
+// Release a reference to a served program.
+static void releaseServedProgram(Server *server, ServedProgram *program) {
+	pthread_mutex_lock(&server->lock);
+	releaseProgram(program);
+	pthread_mutex_unlock(&server->lock);
+}
+
+// Get a reference to a request's program, compiling it or loading it from the
+// bytecode cache if it is not cached by the server. Return NULL and set the
+// request's status if there is no such program.
+static ServedProgram *getRequestProgram(Server *server, ServedRequest *request) {
+	ServedProgram *program = findProgram(server, &request->key);
+	
+	if (program != NULL) {
+		return program;
+	}
+	
+	program = (ServedProgram*)malloc(sizeof(ServedProgram));
+	
+	if (program == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	program->key = request->key;
+	program->referenceCount = 1;
+	program->lastUse = 0;
+	bool isLoaded;
+	
+	if (request->kind == REQUEST_SOURCE) {
+		isLoaded = compileSourceBytes(request->source, request->key.size, &program->bytecode);
+		request->status = RESPONSE_COMPILE_ERROR;
+	} else {
+		isLoaded = loadCache(&request->key, &program->bytecode);
+		request->status = RESPONSE_UNKNOWN_HASH;
+	}
+	
+	if (!isLoaded) {
+		free(program);
+		return NULL;
+	}
+	
+	request->status = RESPONSE_OK;
+	return cacheProgram(server, program);
+}
+
+// Receive a little-endian U64 value from a socket and return whether it was
+// received.
+static bool receiveU64(int socket, uint64_t *value) {
+	uint8_t bytes[8];
+	
+	if (!receiveSocket(socket, bytes, sizeof(bytes))) {
+		return false;
+	}
+	
+	*value = getSocketU64(bytes);
+	return true;
+}
+
+// Receive a number of bytes up to the maximum request size to a new
+// allocation and return whether they were received.
+static bool receiveAllocated(int socket, uint64_t size, uint8_t **bytes) {
+	if (size > REQUEST_MAX_SIZE) {
+		return false;
+	}
+	
+	*bytes = (uint8_t*)malloc(size > 0 ? (size_t)size : 1);
+	
+	if (*bytes == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	return receiveSocket(socket, *bytes, (size_t)size);
+}
+
+// Receive a request from a client's socket after its kind and return whether it
+// is valid.
+static bool receiveRequest(ServedRequest *request) {
+	int socket = request->socket;
+	uint64_t inputSize;
+	
+	if (request->kind == REQUEST_SOURCE) {
+		if (!receiveU64(socket, &request->key.size) || !receiveAllocated(socket, request->key.size, (uint8_t**)&request->source)) {
+			return false;
+		}
+		
+		initCacheKey(&request->key, request->source, (size_t)request->key.size);
+	} else if (request->kind == REQUEST_HASH) {
+		if (!receiveSocket(socket, request->key.digest, DIGEST_SIZE) || !receiveU64(socket, &request->key.size)) {
+			return false;
+		}
+	} else {
+		return false;
+	}
+	
+	if (!receiveU64(socket, &request->outputLimit) || !receiveU64(socket, &request->fuel) || !receiveU64(socket, &inputSize) || !receiveAllocated(socket, inputSize, &request->input)) {
+		return false;
+	}
+	
+	request->inputSize = (size_t)inputSize;
+	return true;
+}
+
+// Read a request's input to bytes up to a capacity and return the number of
+// bytes read.
+static size_t readRequestInput(void *context, uint8_t *bytes, size_t capacity) {
+	ServedRequest *request = (ServedRequest*)context;
+	size_t count = request->inputSize - request->inputNext;
+	count = count < capacity ? count : capacity;
+	memcpy(bytes, request->input + request->inputNext, count);
+	request->inputNext += count;
+	return count;
+}
+
+// Send a chunk of a request's output to its client. Stop the program if it
+// reaches its output limit or the client disconnects.
+static void writeRequestOutput(void *context, const uint8_t *bytes, size_t count) {
+	ServedRequest *request = (ServedRequest*)context;
+	bool isLimited = request->outputLimit != 0 && count > request->outputLimit - request->outputCount;
+	
+	if (isLimited) {
+		count = (size_t)(request->outputLimit - request->outputCount);
+	}
+	
+	if (count > 0) {
+		uint8_t header[4];
+		putSocketU32(header, (uint32_t)count);
+		
+		if (!sendSocket(request->socket, header, sizeof(header)) || !sendSocket(request->socket, bytes, count)) {
+			request->isDisconnected = true;
+			longjmp(request->stop, 1);
+		}
+		
+		request->outputCount += count;
+	}
+	
+	if (isLimited) {
+		request->status = RESPONSE_OUTPUT_LIMIT;
+		longjmp(request->stop, 1);
+	}
+}
+
+// Run a request's program with a worker thread's tape and I/O.
+static void runRequest(Server *server, ServedRequest *request, ServedProgram *program, Tape *tape, IO *io) {
+	memset(tape->memory, 0, tape->size);
+	initCustomIO(io, readRequestInput, writeRequestOutput, request, server->bufferSize);
+	
+	// Programs are stopped early by jumping out of the VM from the output
+	// writer. Programs with a loop iteration limit are run with the metered
+	// engine instead of the server's engine.
+	if (setjmp(request->stop) != 0) {
+		return;
+	}
+	
+	if (request->fuel == 0) {
+		interpretBytecode(program->bytecode.bytes, tape, io, server->engine);
+		return;
+	}
+	
+	VMState state = {0, 0};
+	
+	if (!meterBytecode(program->bytecode.bytes, tape, io, &state, request->fuel)) {
+		request->status = RESPONSE_FUEL_LIMIT;
+	}
+}
+
+// Send a request's response trailer to its client and return whether it was
+// sent.
+static bool sendTrailer(const ServedRequest *request) {
+	uint8_t trailer[4 + RESPONSE_TRAILER_SIZE];
+	putSocketU32(trailer, 0);
+	trailer[4] = (uint8_t)request->status;
+	memcpy(trailer + 5, request->key.digest, DIGEST_SIZE);
+	putSocketU64(trailer + 5 + DIGEST_SIZE, request->key.size);
+	putSocketU64(trailer + 13 + DIGEST_SIZE, request->outputCount);
+	return sendSocket(request->socket, trailer, sizeof(trailer));
+}
+
+// Serve one request from a client's socket with a worker thread's tape and I/O
+// and return whether the client may send another request.
+static bool serveRequest(Server *server, int socket, Tape *tape, IO *io) {
+	ServedRequest request;
+	memset(&request, 0, sizeof(request));
+	request.socket = socket;
+	uint8_t kind;
+	
+	if (!receiveSocket(socket, &kind, 1)) {
+		return false;
+	}
+	
+	request.kind = (RequestKind)kind;
+	bool isValid = receiveRequest(&request);
+	
+	if (isValid) {
+		ServedProgram *program = getRequestProgram(server, &request);
+		
+		if (program != NULL) {
+			runRequest(server, &request, program, tape, io);
+			releaseServedProgram(server, program);
+		}
+	} else {
+		request.status = RESPONSE_BAD_REQUEST;
+	}
+	
+	free(request.source);
+	free(request.input);
+	return !request.isDisconnected && sendTrailer(&request) && isValid;
+}
+
+// Queue a connection with a request waiting for a worker thread, waiting while
+// the queue is full.
+static void queueClient(Server *server, int client) {
+	pthread_mutex_lock(&server->queueLock);
+	
+	while (server->queueCount == SERVER_QUEUE_CAPACITY) {
+		pthread_cond_wait(&server->taken, &server->queueLock);
+	}
+	
+	server->queuedClients[(server->queueFront + server->queueCount++) % SERVER_QUEUE_CAPACITY] = client;
+	pthread_cond_signal(&server->queued);
+	pthread_mutex_unlock(&server->queueLock);
+}
+
+// Take a queued connection, waiting while the queue is empty, and return it, or
+// -1 if the queue is empty and the server has stopped.
+static int takeClient(Server *server) {
+	pthread_mutex_lock(&server->queueLock);
+	
+	while (server->queueCount == 0 && !server->isStopped) {
+		pthread_cond_wait(&server->queued, &server->queueLock);
+	}
+	
+	int client = -1;
+	
+	if (server->queueCount > 0) {
+		client = server->queuedClients[server->queueFront];
+		server->queueFront = (server->queueFront + 1) % SERVER_QUEUE_CAPACITY;
+		server->queueCount--;
+		pthread_cond_signal(&server->taken);
+	}
+	
+	pthread_mutex_unlock(&server->queueLock);
+	return client;
+}
+
+// Return a connection that finished a request to the polling thread, or close
+// it if the server has stopped.
+static void returnClient(Server *server, int client) {
+	pthread_mutex_lock(&server->queueLock);
+	
+	if (server->isStopped) {
+		pthread_mutex_unlock(&server->queueLock);
+		close(client);
+		return;
+	}
+	
+	if (server->idleCount == server->idleCapacity) {
+		int capacity = server->idleCapacity > 0 ? server->idleCapacity * 2 : 16;
+		int *clients = (int*)realloc(server->idleClients, capacity * sizeof(int));
+		
+		if (clients == NULL) {
+			exit(EXIT_FAILURE);
+		}
+		
+		server->idleClients = clients;
+		server->idleCapacity = capacity;
+	}
+	
+	server->idleClients[server->idleCount++] = client;
+	pthread_mutex_unlock(&server->queueLock);
+	
+	// A full pipe already has a pending wake-up, so failed writes are ignored.
+	uint8_t wake = 0;
+	ssize_t written = write(server->wakePipe[1], &wake, 1);
+	(void)written;
+}
+
+// Run requests from queued connections on a worker thread until the server
+// stops.
+static void *runServerWorker(void *argument) {
+	Server *server = (Server*)argument;
+	Tape tape;
+	IO io = {0};
+	
+	if (!initTape(&tape, 0)) {
+		fprintf(stderr, "Could not allocate memory for the tape.\n");
+		return NULL;
+	}
+	
+	int client;
+	
+	while ((client = takeClient(server)) >= 0) {
+		if (serveRequest(server, client, &tape, &io)) {
+			returnClient(server, client);
+		} else {
+			close(client);
+		}
+	}
+	
+	freeTape(&tape);
+	freeIO(&io);
+	return NULL;
+}
+
+// Add a socket to be polled for input, growing the polled sockets if needed.
+static void addPolled(struct pollfd **polled, int *count, int *capacity, int socket) {
+	if (*count == *capacity) {
+		int newCapacity = *capacity * 2;
+		struct pollfd *newPolled = (struct pollfd*)realloc(*polled, newCapacity * sizeof(struct pollfd));
+		
+		if (newPolled == NULL) {
+			exit(EXIT_FAILURE);
+		}
+		
+		*polled = newPolled;
+		*capacity = newCapacity;
+	}
+	
+	(*polled)[*count].fd = socket;
+	(*polled)[*count].events = POLLIN;
+	(*polled)[*count].revents = 0;
+	(*count)++;
+}
+
+// Accept connections and queue each connection with a request for a worker
+// thread until the listening socket fails. Connections are only polled while
+// they are idle, so each request is queued on its own and a worker thread only
+// serves a connection for one request at a time.
+static void pollClients(Server *server) {
+	int polledCount = 0;
+	int polledCapacity = 16;
+	struct pollfd *polled = (struct pollfd*)malloc(polledCapacity * sizeof(struct pollfd));
+	
+	if (polled == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	// The listening socket and the wake pipe are polled before the clients.
+	addPolled(&polled, &polledCount, &polledCapacity, server->socket);
+	addPolled(&polled, &polledCount, &polledCapacity, server->wakePipe[0]);
+	
+	for (;;) {
+		if (poll(polled, (nfds_t)polledCount, -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			
+			break;
+		}
+		
+		// Ready clients are removed by moving the last client into their place,
+		// so clients are checked from last to first.
+		for (int i = polledCount - 1; i >= 2; i--) {
+			if (polled[i].revents != 0) {
+				int client = polled[i].fd;
+				polled[i] = polled[--polledCount];
+				queueClient(server, client);
+			}
+		}
+		
+		if (polled[1].revents != 0) {
+			uint8_t wakes[64];
+			ssize_t readCount = read(server->wakePipe[0], wakes, sizeof(wakes));
+			(void)readCount;
+			pthread_mutex_lock(&server->queueLock);
+			
+			for (int i = 0; i < server->idleCount; i++) {
+				addPolled(&polled, &polledCount, &polledCapacity, server->idleClients[i]);
+			}
+			
+			server->idleCount = 0;
+			pthread_mutex_unlock(&server->queueLock);
+		}
+		
+		if (polled[0].revents != 0) {
+			int client = accept(server->socket, NULL, NULL);
+			
+			if (client >= 0) {
+				addPolled(&polled, &polledCount, &polledCapacity, client);
+			} else if (errno != EINTR && errno != ECONNABORTED) {
+				break;
+			}
+		}
+	}
+	
+	pthread_mutex_lock(&server->queueLock);
+	server->isStopped = true;
+	pthread_cond_broadcast(&server->queued);
+	
+	for (int i = 0; i < server->idleCount; i++) {
+		close(server->idleClients[i]);
+	}
+	
+	server->idleCount = 0;
+	pthread_mutex_unlock(&server->queueLock);
+	
+	for (int i = 2; i < polledCount; i++) {
+		close(polled[i].fd);
+	}
+	
+	free(polled);
+}
+
+// Open a Unix domain socket listening at a path, replacing a stale socket, or
+// return -1 if it could not be opened.
+static int listenSocket(const char *path) {
+	struct sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	
+	if (strlen(path) >= sizeof(address.sun_path)) {
+		return -1;
+	}
+	
+	strcpy(address.sun_path, path);
+	struct stat status;
+	
+	// Only sockets are replaced so that other files are never removed.
+	if (lstat(path, &status) == 0 && S_ISSOCK(status.st_mode)) {
+		unlink(path);
+	}
+	
+	int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+	
+	if (descriptor < 0) {
+		return -1;
+	}
+	
+	if (bind(descriptor, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(descriptor, SOMAXCONN) != 0) {
+		close(descriptor);
+		return -1;
+	}
+	
+	return descriptor;
+}
+#endif // _WIN32
+
+// Serve requests to run programs on a Unix domain socket at a path until an
+// error occurs. Requests are run on a number of worker threads, or one per
+// processor if the number is 0, and compiled programs are kept in a cache with
+// a capacity in programs. Return whether the server could be started.
+bool serve(const char *path, size_t threadCount, size_t cacheCapacity, size_t bufferSize, Engine engine) {
+#ifndef _WIN32
+	Server server;
+	server.socket = listenSocket(path);
+	
+	if (server.socket < 0) {
+		fprintf(stderr, "Could not listen on '%s'.\n", path);
+		return false;
+	}
+	
+	if (threadCount == 0) {
+		long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+		threadCount = processorCount > 0 ? (size_t)processorCount : 1;
+	}
+	
+	server.programCount = 0;
+	server.programCapacity = cacheCapacity < INT32_MAX ? (int)cacheCapacity : INT32_MAX;
+	server.programs = (ServedProgram**)malloc(server.programCapacity * sizeof(ServedProgram*));
+	server.useCount = 0;
+	server.bufferSize = bufferSize;
+	
+	// The threaded engine allocates code that would leak when a program is
+	// stopped early.
+	server.engine = engine == ENGINE_THREADED ? getDefaultEngine() : engine;
+	
+	if (server.programs == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	if (pipe(server.wakePipe) != 0) {
+		fprintf(stderr, "Could not make a pipe for the server.\n");
+		close(server.socket);
+		free(server.programs);
+		return false;
+	}
+	
+	server.queueFront = 0;
+	server.queueCount = 0;
+	server.idleCount = 0;
+	server.idleCapacity = 0;
+	server.idleClients = NULL;
+	server.isStopped = false;
+	
+	// Clients that disconnect are detected by failed sends instead of
+	// signals.
+	signal(SIGPIPE, SIG_IGN);
+	pthread_mutex_init(&server.lock, NULL);
+	pthread_mutex_init(&server.queueLock, NULL);
+	pthread_cond_init(&server.queued, NULL);
+	pthread_cond_init(&server.taken, NULL);
+	fprintf(stderr, "Serving on '%s' (threads: %zu).\n", path, threadCount);
+	pthread_t *threads = (pthread_t*)malloc(threadCount * sizeof(pthread_t));
+	
+	if (threads == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	// The calling thread polls connections for the worker threads.
+	size_t startedCount = 0;
+	
+	while (startedCount < threadCount && pthread_create(&threads[startedCount], NULL, runServerWorker, &server) == 0) {
+		startedCount++;
+	}
+	
+	if (startedCount > 0) {
+		pollClients(&server);
+	}
+	
+	for (size_t i = 0; i < startedCount; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	
+	free(threads);
+	free(server.idleClients);
+	close(server.wakePipe[0]);
+	close(server.wakePipe[1]);
+	pthread_cond_destroy(&server.taken);
+	pthread_cond_destroy(&server.queued);
+	pthread_mutex_destroy(&server.queueLock);
+	fprintf(stderr, "Could not accept connections on '%s'.\n", path);
+	return true;
+#else // _WIN32
+	(void)threadCount;
+	(void)cacheCapacity;
+	(void)bufferSize;
+	(void)engine;
+	fprintf(stderr, "Could not listen on '%s', sockets are not available on Windows.\n", path);
+	return false;
+#endif // _WIN32
+}
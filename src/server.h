@@ -0,0 +1,15 @@
+#ifndef BRAINIAC_SERVER_H
+#define BRAINIAC_SERVER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "vm.h"
+
+// Serve requests to run programs on a Unix domain socket at a path until an
+// error occurs. Requests are run on a number of worker threads, or one per
+// processor if the number is 0, and compiled programs are kept in a cache with
+// a capacity in programs. Return whether the server could be started.
+bool serve(const char *path, size_t threadCount, size_t cacheCapacity, size_t bufferSize, Engine engine);
+
+#endif // BRAINIAC_SERVER_H
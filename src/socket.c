@@ -0,0 +1,124 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "socket.h"
+
+// Put a little-endian U32 value to bytes.
+void putSocketU32(uint8_t *bytes, uint32_t value) {
+	for (int i = 0; i < 4; i++) {
+		bytes[i] = (value >> (i * 8)) & 0xff;
+	}
+}
+
+// Put a little-endian U64 value to bytes.
+void putSocketU64(uint8_t *bytes, uint64_t value) {
+	putSocketU32(bytes, (uint32_t)value);
+	putSocketU32(bytes + 4, (uint32_t)(value >> 32));
+}
+
+// Get a little-endian U32 value from bytes.
+uint32_t getSocketU32(const uint8_t *bytes) {
+	uint32_t value = 0;
+	
+	for (int i = 0; i < 4; i++) {
+		value |= (uint32_t)bytes[i] << (i * 8);
+	}
+	
+	return value;
+}
+
+// Get a little-endian U64 value from bytes.
+uint64_t getSocketU64(const uint8_t *bytes) {
+	return (uint64_t)getSocketU32(bytes) | (uint64_t)getSocketU32(bytes + 4) << 32;
+}
+
+// Send bytes to a socket and return whether they were all sent.
+bool sendSocket(int socket, const void *bytes, size_t count) {
+#ifndef _WIN32
+	const uint8_t *next = (const uint8_t*)bytes;
+	
+	while (count > 0) {
+		ssize_t sent = send(socket, next, count, 0);
+		
+		if (sent < 0 && errno == EINTR) {
+			continue;
+		} else if (sent <= 0) {
+			return false;
+		}
+		
+		next += sent;
+		count -= (size_t)sent;
+	}
+	
+	return true;
+#else // _WIN32
+	(void)socket;
+	(void)bytes;
+	return count == 0;
+#endif // _WIN32
+}
+
+// Receive bytes from a socket and return whether they were all received.
+bool receiveSocket(int socket, void *bytes, size_t count) {
+#ifndef _WIN32
+	uint8_t *next = (uint8_t*)bytes;
+	
+	while (count > 0) {
+		ssize_t received = recv(socket, next, count, 0);
+		
+		if (received < 0 && errno == EINTR) {
+			continue;
+		} else if (received <= 0) {
+			return false;
+		}
+		
+		next += received;
+		count -= (size_t)received;
+	}
+	
+	return true;
+#else // _WIN32
+	(void)socket;
+	(void)bytes;
+	return count == 0;
+#endif // _WIN32
+}
+
+// Open a Unix domain socket connected to a path, or return -1 if it could not
+// be connected.
+int connectSocket(const char *path) {
+#ifndef _WIN32
+	struct sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	
+	if (strlen(path) >= sizeof(address.sun_path)) {
+		return -1;
+	}
+	
+	strcpy(address.sun_path, path);
+	int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+	
+	if (descriptor < 0) {
+		return -1;
+	}
+	
+	if (connect(descriptor, (struct sockaddr*)&address, sizeof(address)) != 0) {
+		close(descriptor);
+		return -1;
+	}
+	
+	return descriptor;
+#else // _WIN32
+	(void)path;
+	return -1;
+#endif // _WIN32
+}
@@ -0,0 +1,56 @@
+#ifndef BRAINIAC_SOCKET_H
+#define BRAINIAC_SOCKET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "digest.h"
+
+// The kind of a request to a server.
+typedef enum {
+	REQUEST_SOURCE = 'S', // Run a program from its source code.
+	REQUEST_HASH = 'H', // Run a program from the cache key of its source code.
+} RequestKind;
+
+// The status of a response from a server.
+typedef enum {
+	RESPONSE_OK, // The program halted.
+	RESPONSE_UNKNOWN_HASH, // No program is cached with the cache key.
+	RESPONSE_COMPILE_ERROR, // The program could not be compiled.
+	RESPONSE_OUTPUT_LIMIT, // The program was stopped at its output limit.
+	RESPONSE_BAD_REQUEST, // The request was malformed or too large.
+	RESPONSE_FUEL_LIMIT, // The program was stopped at its loop iteration limit.
+} ResponseStatus;
+
+// The size of a response's trailer in bytes. The trailer follows an empty
+// chunk and contains the status, the cache key's digest and size, and the
+// number of bytes output, in little-endian order.
+#define RESPONSE_TRAILER_SIZE (17 + DIGEST_SIZE)
+
+// The maximum size of a request's source code or input in bytes.
+#define REQUEST_MAX_SIZE ((uint64_t)1 << 26)
+
+// Put a little-endian U32 value to bytes.
+void putSocketU32(uint8_t *bytes, uint32_t value);
+
+// Put a little-endian U64 value to bytes.
+void putSocketU64(uint8_t *bytes, uint64_t value);
+
+// Get a little-endian U32 value from bytes.
+uint32_t getSocketU32(const uint8_t *bytes);
+
+// Get a little-endian U64 value from bytes.
+uint64_t getSocketU64(const uint8_t *bytes);
+
+// Send bytes to a socket and return whether they were all sent.
+bool sendSocket(int socket, const void *bytes, size_t count);
+
+// Receive bytes from a socket and return whether they were all received.
+bool receiveSocket(int socket, void *bytes, size_t count);
+
+// Open a Unix domain socket connected to a path, or return -1 if it could not
+// be connected.
+int connectSocket(const char *path);
+
+#endif // BRAINIAC_SOCKET_H
@@ -0,0 +1,112 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "source.h"
+
+#ifndef _WIN32
+// Map source code from a regular file and return whether it could be mapped.
+static bool mapSource(Source *source, const char *path) {
+	int descriptor = open(path, O_RDONLY);
+	
+	if (descriptor < 0) {
+		return false;
+	}
+	
+	// Empty files and files that are not regular files, such as pipes, cannot
+	// be mapped.
+	struct stat status;
+	
+	if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size <= 0 || (uintmax_t)status.st_size > SIZE_MAX) {
+		close(descriptor);
+		return false;
+	}
+	
+	void *mapping = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	close(descriptor);
+	
+	if (mapping == MAP_FAILED) {
+		return false;
+	}
+	
+	source->bytes = (char*)mapping;
+	source->size = (size_t)status.st_size;
+	source->isMapped = true;
+	return true;
+}
+#endif // _WIN32
+
+// Read source code from an open file and return whether it could be read.
+bool readSource(Source *source, FILE *file) {
+	size_t capacity = 0;
+	source->bytes = NULL;
+	source->size = 0;
+	source->isMapped = false;
+	
+	do {
+		if (source->size == capacity) {
+			capacity = capacity != 0 ? capacity * 2 : 4096;
+			source->bytes = (char*)realloc(source->bytes, capacity * sizeof(char));
+			
+			if (source->bytes == NULL) {
+				exit(EXIT_FAILURE);
+			}
+		}
+		
+		source->size += fread(source->bytes + source->size, sizeof(char), capacity - source->size, file);
+	} while (!feof(file) && !ferror(file));
+	
+	if (ferror(file)) {
+		free(source->bytes);
+		source->bytes = NULL;
+		return false;
+	}
+	
+	return true;
+}
+
+// Load source code from a path and return whether it could be loaded.
+bool loadSource(Source *source, const char *path) {
+#ifndef _WIN32
+	if (mapSource(source, path)) {
+		return true;
+	}
+#endif // _WIN32
+	FILE *file = fopen(path, "rb");
+	
+	if (file == NULL) {
+		fprintf(stderr, "Could not open '%s', file may not exist.\n", path);
+		return false;
+	}
+	
+	bool isRead = readSource(source, file);
+	fclose(file);
+	
+	if (!isRead) {
+		fprintf(stderr, "Encountered an error while reading '%s'.\n", path);
+	}
+	
+	return isRead;
+}
+
+// Free source code.
+void freeSource(Source *source) {
+#ifndef _WIN32
+	if (source->isMapped) {
+		munmap(source->bytes, source->size);
+		source->bytes = NULL;
+		return;
+	}
+#endif // _WIN32
+	free(source->bytes);
+	source->bytes = NULL;
+}
@@ -0,0 +1,30 @@
+#ifndef BRAINIAC_SOURCE_H
+#define BRAINIAC_SOURCE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Source code loaded from a file.
+typedef struct {
+	// The source code's bytes.
+	char *bytes;
+	
+	// The source code's size in bytes.
+	size_t size;
+	
+	// Whether the source code's bytes are mapped from the file instead of
+	// being allocated.
+	bool isMapped;
+} Source;
+
+// Load source code from a path and return whether it could be loaded.
+bool loadSource(Source *source, const char *path);
+
+// Read source code from an open file and return whether it could be read.
+bool readSource(Source *source, FILE *file);
+
+// Free source code.
+void freeSource(Source *source);
+
+#endif // BRAINIAC_SOURCE_H
@@ -0,0 +1,93 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#include "stats.h"
+
+// The names of phases in human-readable statistics by phase.
+static const char *const phaseNames[PHASE_COUNT] = {
+	[PHASE_LOAD] = "Load",
+	[PHASE_PARSE] = "Parse",
+	[PHASE_OPTIMIZE] = "Optimize",
+	[PHASE_GENERATE] = "Generate",
+	[PHASE_EXECUTE] = "Execute",
+};
+
+// The names of phases in JSON statistics by phase.
+static const char *const phaseKeys[PHASE_COUNT] = {
+	[PHASE_LOAD] = "load",
+	[PHASE_PARSE] = "parse",
+	[PHASE_OPTIMIZE] = "optimize",
+	[PHASE_GENERATE] = "generate",
+	[PHASE_EXECUTE] = "execute",
+};
+
+// Get the time of a monotonic clock in nanoseconds.
+uint64_t getClock() {
+#ifndef _WIN32
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint64_t)time.tv_sec * 1000000000 + (uint64_t)time.tv_nsec;
+#else // _WIN32
+	// The clock function measures wall time on Windows.
+	return (uint64_t)clock() * (1000000000 / CLOCKS_PER_SEC);
+#endif // _WIN32
+}
+
+// Get a time in nanoseconds in milliseconds.
+static double getMilliseconds(uint64_t time) {
+	return (double)time / 1000000.0;
+}
+
+// Get the total wall time of statistics' phases in nanoseconds.
+static uint64_t getTotalTime(const Stats *stats) {
+	uint64_t total = 0;
+	
+	for (int i = 0; i < PHASE_COUNT; i++) {
+		total += stats->phaseTimes[i];
+	}
+	
+	return total;
+}
+
+// Print statistics to a file in a human-readable format.
+void printStats(const Stats *stats, FILE *file) {
+	fprintf(file, "\nStatistics:\n");
+	
+	for (int i = 0; i < PHASE_COUNT; i++) {
+		fprintf(file, "%-24s %16.3f ms\n", phaseNames[i], getMilliseconds(stats->phaseTimes[i]));
+	}
+	
+	fprintf(file, "%-24s %16.3f ms\n", "Total", getMilliseconds(getTotalTime(stats)));
+	fprintf(file, "%-24s %16zu bytes\n", "Source size", stats->sourceSize);
+	fprintf(file, "%-24s %16d\n", "Parsed nodes", stats->parsedNodeCount);
+	fprintf(file, "%-24s %16d\n", "Optimized nodes", stats->optimizedNodeCount);
+	fprintf(file, "%-24s %16d\n", "Optimizer passes", stats->passCount);
+	fprintf(file, "%-24s %16zu bytes\n", "Bytecode size", stats->bytecodeSize);
+	fprintf(file, "%-24s %16llu\n", "Instructions", (unsigned long long)stats->instructionCount);
+	char range[48];
+	snprintf(range, sizeof(range), "%td to %td", stats->lowestPointer, stats->highestPointer);
+	fprintf(file, "%-24s %16s\n", "Pointer range", range);
+	fprintf(file, "%-24s %16llu bytes\n", "Input", (unsigned long long)stats->inputCount);
+	fprintf(file, "%-24s %16llu bytes\n", "Output", (unsigned long long)stats->outputCount);
+}
+
+// Print statistics to a file as a single line of JSON.
+void printStatsJson(const Stats *stats, FILE *file) {
+	fprintf(file, "{\"phases_ms\": {");
+	
+	for (int i = 0; i < PHASE_COUNT; i++) {
+		fprintf(file, "\"%s\": %.3f, ", phaseKeys[i], getMilliseconds(stats->phaseTimes[i]));
+	}
+	
+	fprintf(file, "\"total\": %.3f}", getMilliseconds(getTotalTime(stats)));
+	fprintf(file, ", \"source_bytes\": %zu", stats->sourceSize);
+	fprintf(file, ", \"parsed_nodes\": %d", stats->parsedNodeCount);
+	fprintf(file, ", \"optimized_nodes\": %d", stats->optimizedNodeCount);
+	fprintf(file, ", \"optimizer_passes\": %d", stats->passCount);
+	fprintf(file, ", \"bytecode_bytes\": %zu", stats->bytecodeSize);
+	fprintf(file, ", \"instructions\": %llu", (unsigned long long)stats->instructionCount);
+	fprintf(file, ", \"pointer_range\": [%td, %td]", stats->lowestPointer, stats->highestPointer);
+	fprintf(file, ", \"input_bytes\": %llu", (unsigned long long)stats->inputCount);
+	fprintf(file, ", \"output_bytes\": %llu}\n", (unsigned long long)stats->outputCount);
+}
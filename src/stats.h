@@ -0,0 +1,63 @@
+#ifndef BRAINIAC_STATS_H
+#define BRAINIAC_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// A timed phase of running a program.
+typedef enum {
+	PHASE_LOAD, // Load source code.
+	PHASE_PARSE, // Scan and parse source code to an AST.
+	PHASE_OPTIMIZE, // Optimize the AST.
+	PHASE_GENERATE, // Generate bytecode from the AST.
+	PHASE_EXECUTE, // Run the bytecode.
+	PHASE_COUNT, // The number of phases.
+} Phase;
+
+// Statistics about compiling and running a program.
+typedef struct {
+	// The wall time spent in each phase in nanoseconds by phase.
+	uint64_t phaseTimes[PHASE_COUNT];
+	
+	// The source code's size in bytes.
+	size_t sourceSize;
+	
+	// The number of nodes in the parsed AST.
+	int parsedNodeCount;
+	
+	// The number of nodes in the optimized AST.
+	int optimizedNodeCount;
+	
+	// The number of times the optimizer applied its rules to a node.
+	int passCount;
+	
+	// The bytecode's size in bytes.
+	size_t bytecodeSize;
+	
+	// The number of instructions dispatched.
+	uint64_t instructionCount;
+	
+	// The lowest memory offset accessed through the memory pointer.
+	ptrdiff_t lowestPointer;
+	
+	// The highest memory offset accessed through the memory pointer.
+	ptrdiff_t highestPointer;
+	
+	// The number of bytes input.
+	uint64_t inputCount;
+	
+	// The number of bytes output.
+	uint64_t outputCount;
+} Stats;
+
+// Get the time of a monotonic clock in nanoseconds.
+uint64_t getClock();
+
+// Print statistics to a file in a human-readable format.
+void printStats(const Stats *stats, FILE *file);
+
+// Print statistics to a file as a single line of JSON.
+void printStatsJson(const Stats *stats, FILE *file);
+
+#endif // BRAINIAC_STATS_H
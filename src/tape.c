@@ -0,0 +1,203 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "io.h"
+#include "scan.h"
+#include "tape.h"
+
+// The message reported for out of bounds memory accesses.
+static const char outOfBoundsMessage[] = "Memory pointer out of bounds.\n";
+
+#ifndef _WIN32
+// The size of the guard regions before and after a bounded tape in bytes.
+// Memory accesses that skip past the whole guard region are not reported, so
+// this is made much larger than the furthest offset or move of any operation.
+#define TAPE_GUARD_SIZE (sizeof(size_t) >= 8 ? (size_t)1 << 30 : (size_t)1 << 20)
+
+// The start of the current bounded tape's mapping.
+static uint8_t *guardedStart = NULL;
+
+// The end of the current bounded tape's mapping.
+static uint8_t *guardedEnd = NULL;
+
+// Handle a segmentation fault from accessing a guard page.
+static void handleFault(int signal, siginfo_t *info, void *context) {
+	(void)context;
+	uint8_t *address = (uint8_t*)info->si_addr;
+	
+	if (address >= guardedStart && address < guardedEnd) {
+		flushOutputRaw(getStandardIO());
+		ssize_t result = write(STDERR_FILENO, outOfBoundsMessage, sizeof(outOfBoundsMessage) - 1);
+		(void)result;
+		_exit(EXIT_FAILURE);
+	}
+	
+	// The fault is not from a guard page, so return to fault again with the
+	// default handler.
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = SIG_DFL;
+	sigemptyset(&action.sa_mask);
+	sigaction(signal, &action, NULL);
+}
+
+// Install the handler for faults from accessing guard pages.
+static void installFaultHandler() {
+	static bool isInstalled = false;
+	
+	if (isInstalled) {
+		return;
+	}
+	
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = handleFault;
+	action.sa_flags = SA_SIGINFO;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGSEGV, &action, NULL);
+	sigaction(SIGBUS, &action, NULL);
+	isInstalled = true;
+}
+#endif // _WIN32
+
+// Get the size of a bounded tape in cells from a requested size, or 0 if the
+// tape would be too large. The size is rounded up to whole pages so that both
+// ends of the tape are guarded exactly.
+size_t getBoundedTapeSize(size_t size) {
+#ifndef _WIN32
+	size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+	
+	if (size > SIZE_MAX - pageSize - 2 * TAPE_GUARD_SIZE) {
+		return 0;
+	}
+	
+	return (size + pageSize - 1) / pageSize * pageSize;
+#else // _WIN32
+	return size;
+#endif // _WIN32
+}
+
+#ifndef _WIN32
+// Initialize a bounded tape surrounded by guard pages and return whether it
+// could be allocated.
+static bool initBoundedTape(Tape *tape, size_t size) {
+	size = getBoundedTapeSize(size);
+	
+	if (size == 0) {
+		return false;
+	}
+	
+	size_t mappingSize = size + 2 * TAPE_GUARD_SIZE;
+	void *mapping = mmap(NULL, mappingSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	
+	if (mapping == MAP_FAILED) {
+		return false;
+	}
+	
+	uint8_t *memory = (uint8_t*)mapping + TAPE_GUARD_SIZE;
+	
+	if (mprotect(memory, size, PROT_READ | PROT_WRITE) != 0) {
+		munmap(mapping, mappingSize);
+		return false;
+	}
+	
+	tape->memory = memory;
+	tape->size = size;
+	tape->mask = SIZE_MAX;
+	tape->mapping = (uint8_t*)mapping;
+	tape->mappingSize = mappingSize;
+	guardedStart = tape->mapping;
+	guardedEnd = tape->mapping + mappingSize;
+	installFaultHandler();
+	return true;
+}
+#endif // _WIN32
+
+// Initialize a tape from its size in cells and return whether it could be
+// allocated. A size of 0 gives a wrapping 64 KiB tape, and other sizes give a
+// bounded tape that reports out of bounds memory accesses.
+bool initTape(Tape *tape, size_t size) {
+	if (size != 0) {
+#ifndef _WIN32
+		return initBoundedTape(tape, size);
+#else // _WIN32
+		return false;
+#endif // _WIN32
+	}
+	
+	tape->memory = (uint8_t*)calloc(UINT16_MAX + 1, sizeof(uint8_t));
+	tape->size = UINT16_MAX + 1;
+	tape->mask = UINT16_MAX;
+	tape->mapping = NULL;
+	tape->mappingSize = 0;
+	return tape->memory != NULL;
+}
+
+// Free a tape's memory.
+void freeTape(Tape *tape) {
+	if (tape->mapping == NULL) {
+		free(tape->memory);
+		return;
+	}
+#ifndef _WIN32
+	if (guardedStart == tape->mapping) {
+		guardedStart = NULL;
+		guardedEnd = NULL;
+	}
+	
+	munmap(tape->mapping, tape->mappingSize);
+#endif // _WIN32
+}
+
+// Return the index of the nearest zero memory cell on a tape at or beyond an
+// index by multiples of a signed stride. Return the tape's size on a wrapping
+// tape or report an out of bounds access on a bounded tape if there is no such
+// cell.
+size_t findTapeZero(const Tape *tape, size_t index, int stride) {
+	bool isWrapping = tape->mask != SIZE_MAX;
+	size_t zero = tape->size;
+	
+	if (isWrapping || index < tape->size) {
+		if (stride > 0) {
+			zero = scanRight(tape->memory, tape->size, index, (size_t)stride, isWrapping);
+		} else {
+			zero = scanLeft(tape->memory, tape->size, index, (size_t)-stride, isWrapping);
+		}
+	}
+	
+	if (zero == tape->size && !isWrapping) {
+		reportOutOfBounds();
+	}
+	
+	return zero;
+}
+
+// Return the index of the nearest zero memory cell on a tape at or beyond an
+// index by multiples of a signed stride. Loop forever on a wrapping tape or
+// report an out of bounds access on a bounded tape if there is no such cell.
+size_t scanTape(const Tape *tape, size_t index, int stride) {
+	size_t zero = findTapeZero(tape, index, stride);
+	
+	if (zero == tape->size) {
+		for (;;) {}
+	}
+	
+	return zero;
+}
+
+// Report an out of bounds memory access and exit. Only programs using the
+// standard I/O run on bounded tapes, so their output is flushed first.
+void reportOutOfBounds() {
+	flushOutput(getStandardIO());
+	fputs(outOfBoundsMessage, stderr);
+	exit(EXIT_FAILURE);
+}
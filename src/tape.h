@@ -0,0 +1,54 @@
+#ifndef BRAINIAC_TAPE_H
+#define BRAINIAC_TAPE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A program's memory.
+typedef struct {
+	// The tape's first memory cell.
+	uint8_t *memory;
+	
+	// The tape's size in cells.
+	size_t size;
+	
+	// The mask applied to memory indices. This is one less than the size for
+	// wrapping tapes, and SIZE_MAX for bounded tapes.
+	size_t mask;
+	
+	// The start of the tape's mapping, including guard pages.
+	uint8_t *mapping;
+	
+	// The size of the tape's mapping in bytes.
+	size_t mappingSize;
+} Tape;
+
+// Initialize a tape from its size in cells and return whether it could be
+// allocated. A size of 0 gives a wrapping 64 KiB tape, and other sizes give a
+// bounded tape that reports out of bounds memory accesses.
+bool initTape(Tape *tape, size_t size);
+
+// Get the size of a bounded tape in cells from a requested size, or 0 if the
+// tape would be too large.
+size_t getBoundedTapeSize(size_t size);
+
+// Free a tape's memory.
+void freeTape(Tape *tape);
+
+// Return the index of the nearest zero memory cell on a tape at or beyond an
+// index by multiples of a signed stride. Return the tape's size on a wrapping
+// tape or report an out of bounds access on a bounded tape if there is no such
+// cell.
+size_t findTapeZero(const Tape *tape, size_t index, int stride);
+
+// Return the index of the nearest zero memory cell on a tape at or beyond an
+// index by multiples of a signed stride. Loop forever on a wrapping tape or
+// report an out of bounds access on a bounded tape if there is no such cell.
+size_t scanTape(const Tape *tape, size_t index, int stride);
+
+// Report an out of bounds memory access and exit. Only programs using the
+// standard I/O run on bounded tapes, so their output is flushed first.
+void reportOutOfBounds();
+
+#endif // BRAINIAC_TAPE_H
@@ -0,0 +1,346 @@
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "tape.h"
+#include "transpiler.h"
+
+// The state of transpiling a program to C.
+typedef struct {
+	// The file to write C source code to.
+	FILE *file;
+	
+	// The current indentation depth.
+	int depth;
+	
+	// Whether the tape wraps around at 64 KiB instead of being bounded.
+	bool isWrapping;
+} Transpiler;
+
+// The runtime support code for transpiled programs. The program's memory is
+// defined before it. Functions are inline so that unused functions do not cause
+// warnings.
+static const char runtimeSource[] =
+	"#include <errno.h>\n"
+	"#include <stdio.h>\n"
+	"#include <stdlib.h>\n"
+	"#include <string.h>\n"
+	"\n"
+	"#ifndef _WIN32\n"
+	"#include <unistd.h>\n"
+	"#endif // _WIN32\n"
+	"\n"
+	"// The output buffer.\n"
+	"static uint8_t outputBytes[65536];\n"
+	"\n"
+	"// The number of bytes in the output buffer.\n"
+	"static size_t outputCount = 0;\n"
+	"\n"
+	"// The input buffer.\n"
+	"static uint8_t inputBytes[65536];\n"
+	"\n"
+	"// The number of bytes in the input buffer.\n"
+	"static size_t inputCount = 0;\n"
+	"\n"
+	"// The index of the next byte to input from the input buffer.\n"
+	"static size_t inputNext = 0;\n"
+	"\n"
+	"// Flush buffered output.\n"
+	"static inline void flushOutput(void) {\n"
+	"\tfwrite(outputBytes, sizeof(uint8_t), outputCount, stdout);\n"
+	"\tfflush(stdout);\n"
+	"\toutputCount = 0;\n"
+	"}\n"
+	"\n"
+	"// Output a byte.\n"
+	"static inline void outputByte(uint8_t value) {\n"
+	"\toutputBytes[outputCount++] = value;\n"
+	"\t\n"
+	"\tif (outputCount == sizeof(outputBytes)) {\n"
+	"\t\tflushOutput();\n"
+	"\t}\n"
+	"}\n"
+	"\n"
+	"// Output bytes.\n"
+	"static inline void outputData(const uint8_t *bytes, size_t count) {\n"
+	"\tif (outputCount + count > sizeof(outputBytes)) {\n"
+	"\t\tflushOutput();\n"
+	"\t\t\n"
+	"\t\tif (count >= sizeof(outputBytes)) {\n"
+	"\t\t\tfwrite(bytes, sizeof(uint8_t), count, stdout);\n"
+	"\t\t\treturn;\n"
+	"\t\t}\n"
+	"\t}\n"
+	"\t\n"
+	"\tmemcpy(outputBytes + outputCount, bytes, count);\n"
+	"\toutputCount += count;\n"
+	"}\n"
+	"\n"
+	"// Input a byte, or 0 at the end of input.\n"
+	"static inline uint8_t inputByte(void) {\n"
+	"\tif (inputNext == inputCount) {\n"
+	"\t\tflushOutput();\n"
+	"\t\tinputNext = 0;\n"
+	"\t\tinputCount = 0;\n"
+	"#ifndef _WIN32\n"
+	"\t\tssize_t count;\n"
+	"\t\t\n"
+	"\t\tdo {\n"
+	"\t\t\tcount = read(STDIN_FILENO, inputBytes, sizeof(inputBytes));\n"
+	"\t\t} while (count < 0 && errno == EINTR);\n"
+	"\t\t\n"
+	"\t\tif (count <= 0) {\n"
+	"\t\t\treturn 0;\n"
+	"\t\t}\n"
+	"\t\t\n"
+	"\t\tinputCount = (size_t)count;\n"
+	"#else // _WIN32\n"
+	"\t\tint value = getchar();\n"
+	"\t\t\n"
+	"\t\tif (value == EOF) {\n"
+	"\t\t\treturn 0;\n"
+	"\t\t}\n"
+	"\t\t\n"
+	"\t\tinputBytes[inputCount++] = (uint8_t)value;\n"
+	"#endif // _WIN32\n"
+	"\t}\n"
+	"\t\n"
+	"\treturn inputBytes[inputNext++];\n"
+	"}\n"
+	"\n"
+	"// Report an out of bounds memory access and exit.\n"
+	"static inline size_t reportOutOfBounds(void) {\n"
+	"\tflushOutput();\n"
+	"\tfputs(\"Memory pointer out of bounds.\\n\", stderr);\n"
+	"\texit(EXIT_FAILURE);\n"
+	"}\n"
+	"\n";
+
+// Write formatted C source code to a transpiler's file.
+static void emit(Transpiler *transpiler, const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	vfprintf(transpiler->file, format, args);
+	va_end(args);
+}
+
+// Write indentation for a new line of C source code to a transpiler's file.
+static void emitIndent(Transpiler *transpiler) {
+	for (int i = 0; i < transpiler->depth; i++) {
+		emit(transpiler, "\t");
+	}
+}
+
+// Write an expression for memory at an offset to a transpiler's file.
+static void emitCell(Transpiler *transpiler, int offset) {
+	if (offset == 0) {
+		emit(transpiler, transpiler->isWrapping ? "memory[pointer]" : "memory[CELL(0)]");
+	} else if (transpiler->isWrapping) {
+		emit(transpiler, "memory[(uint16_t)(pointer %c %d)]", offset > 0 ? '+' : '-', offset > 0 ? offset : -offset);
+	} else {
+		emit(transpiler, "memory[CELL(%d)]", offset);
+	}
+}
+
+// Transpile a node to C.
+static void transpileNode(Transpiler *transpiler, Node *node);
+
+// Transpile a node's children to C.
+static void transpileChildren(Transpiler *transpiler, Node *node) {
+	for (int i = 0; i < node->childCount; i++) {
+		transpileNode(transpiler, node->children[i]);
+	}
+}
+
+// Transpile a program node to C.
+static void transpileProgramNode(Transpiler *transpiler, Node *node) {
+	emit(transpiler, "\n// Run the program.\nint main(void) {\n");
+	transpiler->depth++;
+	emitIndent(transpiler);
+	emit(transpiler, transpiler->isWrapping ? "uint16_t pointer = 0;\n" : "size_t pointer = 0;\n");
+	emitIndent(transpiler);
+	emit(transpiler, "(void)memory; // Programs without memory accesses are valid.\n");
+	emitIndent(transpiler);
+	emit(transpiler, "(void)pointer;\n");
+	transpileChildren(transpiler, node);
+	emitIndent(transpiler);
+	emit(transpiler, "flushOutput();\n");
+	emitIndent(transpiler);
+	emit(transpiler, "return EXIT_SUCCESS;\n");
+	transpiler->depth--;
+	emit(transpiler, "}\n");
+}
+
+// Transpile a loop node or repeat node to C.
+static void transpileLoopNode(Transpiler *transpiler, Node *node) {
+	if (node->kind == NODE_REPEAT && (uint8_t)node->value != 1) {
+		emitIndent(transpiler);
+		emitCell(transpiler, 0);
+		emit(transpiler, " *= %d;\n", (uint8_t)node->value);
+	}
+	
+	// Loops that run at most once do not need to be repeated.
+	emitIndent(transpiler);
+	emit(transpiler, node->kind == NODE_LOOP && isLoopOnce(node) ? "if (" : "while (");
+	emitCell(transpiler, 0);
+	emit(transpiler, " != 0) {\n");
+	transpiler->depth++;
+	transpileChildren(transpiler, node);
+	
+	// Repeat loops count down their iterations in the pointed memory.
+	if (node->kind == NODE_REPEAT) {
+		emitIndent(transpiler);
+		emitCell(transpiler, 0);
+		emit(transpiler, "--;\n");
+	}
+	
+	transpiler->depth--;
+	emitIndent(transpiler);
+	emit(transpiler, "}\n");
+}
+
+// Transpile a move node to C.
+static void transpileMoveNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	
+	if (node->value >= 0) {
+		emit(transpiler, "pointer += %d;\n", node->value);
+	} else {
+		emit(transpiler, "pointer -= %d;\n", -node->value);
+	}
+}
+
+// Transpile an add node to C.
+static void transpileAddNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	emitCell(transpiler, node->offset);
+	emit(transpiler, " += %d;\n", (uint8_t)node->value);
+}
+
+// Transpile an output node to C.
+static void transpileOutputNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	emit(transpiler, "outputByte(");
+	emitCell(transpiler, node->offset);
+	emit(transpiler, ");\n");
+}
+
+// Transpile an input node to C.
+static void transpileInputNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	emitCell(transpiler, node->offset);
+	emit(transpiler, " = inputByte();\n");
+}
+
+// Transpile a set node to C.
+static void transpileSetNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	emitCell(transpiler, node->offset);
+	emit(transpiler, " = %d;\n", (uint8_t)node->value);
+}
+
+// Transpile a multiply node to C.
+static void transpileMulNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	emitCell(transpiler, node->offset);
+	emit(transpiler, " += ");
+	emitCell(transpiler, 0);
+	
+	if ((uint8_t)node->value != 1) {
+		emit(transpiler, " * %d", (uint8_t)node->value);
+	}
+	
+	emit(transpiler, ";\n");
+}
+
+// Transpile a scan node to C.
+static void transpileScanNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	emit(transpiler, "while (");
+	emitCell(transpiler, 0);
+	emit(transpiler, " != 0) {\n");
+	transpiler->depth++;
+	transpileMoveNode(transpiler, node);
+	transpiler->depth--;
+	emitIndent(transpiler);
+	emit(transpiler, "}\n");
+}
+
+// Transpile a write node to C.
+static void transpileWriteNode(Transpiler *transpiler, Node *node) {
+	emitIndent(transpiler);
+	emit(transpiler, "{\n");
+	transpiler->depth++;
+	emitIndent(transpiler);
+	emit(transpiler, "static const uint8_t data[%d] = {", node->value);
+	
+	for (int i = 0; i < node->value; i++) {
+		if (i % 16 == 0) {
+			emit(transpiler, "\n");
+			emitIndent(transpiler);
+			emit(transpiler, "\t");
+		}
+		
+		emit(transpiler, i % 16 == 15 || i == node->value - 1 ? "%d," : "%d, ", node->data[i]);
+	}
+	
+	emit(transpiler, "\n");
+	emitIndent(transpiler);
+	emit(transpiler, "};\n\n");
+	emitIndent(transpiler);
+	emit(transpiler, "outputData(data, sizeof(data));\n");
+	transpiler->depth--;
+	emitIndent(transpiler);
+	emit(transpiler, "}\n");
+}
+
+// Transpile a node to C.
+static void transpileNode(Transpiler *transpiler, Node *node) {
+	switch (node->kind) {
+		case NODE_PROGRAM: transpileProgramNode(transpiler, node); break;
+		case NODE_LOOP: transpileLoopNode(transpiler, node); break;
+		case NODE_MOVE: transpileMoveNode(transpiler, node); break;
+		case NODE_ADD: transpileAddNode(transpiler, node); break;
+		case NODE_OUTPUT: transpileOutputNode(transpiler, node); break;
+		case NODE_INPUT: transpileInputNode(transpiler, node); break;
+		case NODE_SET: transpileSetNode(transpiler, node); break;
+		case NODE_MUL: transpileMulNode(transpiler, node); break;
+		case NODE_SCAN: transpileScanNode(transpiler, node); break;
+		case NODE_REPEAT: transpileLoopNode(transpiler, node); break;
+		case NODE_WRITE: transpileWriteNode(transpiler, node); break;
+	}
+}
+
+// Transpile a program to a self-contained C translation unit and write it to a
+// file. A tape size of 0 gives a wrapping 64 KiB tape, and other sizes give a
+// bounded tape that reports out of bounds memory accesses. Return whether the
+// tape size is valid.
+bool transpileProgram(Node *program, size_t tapeSize, FILE *file) {
+	Transpiler transpiler;
+	transpiler.file = file;
+	transpiler.depth = 0;
+	transpiler.isWrapping = tapeSize == 0;
+	
+	if (!transpiler.isWrapping) {
+		tapeSize = getBoundedTapeSize(tapeSize);
+		
+		if (tapeSize == 0) {
+			return false;
+		}
+	}
+	
+	emit(&transpiler, "// Transpiled from Brainfuck by Brainiac.\n\n");
+	emit(&transpiler, "#define _POSIX_C_SOURCE 200809L\n\n");
+	emit(&transpiler, "#include <stdint.h>\n\n");
+	emit(&transpiler, "// The program's memory.\n");
+	emit(&transpiler, "static uint8_t memory[%zu];\n\n", transpiler.isWrapping ? (size_t)UINT16_MAX + 1 : tapeSize);
+	emit(&transpiler, "%s", runtimeSource);
+	
+	if (!transpiler.isWrapping) {
+		emit(&transpiler, "// Get the index of memory at an offset from the memory pointer, reporting\n");
+		emit(&transpiler, "// out of bounds memory accesses.\n");
+		emit(&transpiler, "#define CELL(offset) (pointer + (size_t)(offset) < sizeof(memory) ? pointer + (size_t)(offset) : reportOutOfBounds())\n");
+	}
+	
+	transpileNode(&transpiler, program);
+	return true;
+}
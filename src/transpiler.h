@@ -0,0 +1,16 @@
+#ifndef BRAINIAC_TRANSPILER_H
+#define BRAINIAC_TRANSPILER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "node.h"
+
+// Transpile a program to a self-contained C translation unit and write it to a
+// file. A tape size of 0 gives a wrapping 64 KiB tape, and other sizes give a
+// bounded tape that reports out of bounds memory accesses. Return whether the
+// tape size is valid.
+bool transpileProgram(Node *program, size_t tapeSize, FILE *file);
+
+#endif // BRAINIAC_TRANSPILER_H
@@ -1,192 +1,770 @@
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef BRAINIAC_DEBUG
 #include <stdio.h>
+#endif // BRAINIAC_DEBUG
 
+#include "io.h"
 #include "opcode.h"
 #include "vm.h"
 
-// Interpret bytecode.
-void interpretBytecode(uint8_t *bytecode) {
-#define VM_U8() (*bytecode++)
-#define VM_U16() (bytecode += 2, (uint16_t)((bytecode[-1] << 8) | bytecode[-2]))
+// Computed goto is supported by GCC-compatible compilers.
 #ifdef __GNUC__
-	__label__
-	vm_OP_HLT,
-	vm_OP_RGT,
-	vm_OP_RGT_U8,
-	vm_OP_RGT_U16,
-	vm_OP_LFT,
-	vm_OP_LFT_U8,
-	vm_OP_LFT_U16,
-	vm_OP_INC,
-	vm_OP_INC_U8,
-	vm_OP_DEC,
-	vm_OP_DEC_U8,
-	vm_OP_OUT,
-	vm_OP_INP,
-	vm_OP_BRZ_U8,
-	vm_OP_BRZ_U16,
-	vm_OP_BNZ_U8,
-	vm_OP_BNZ_U16,
-	vm_OP_SET_0,
-	vm_OP_SET_1,
-	vm_OP_SET_U8;
-	
-	static void *dispatchTable[] = {
-		[OP_HLT] = &&vm_OP_HLT,
-		[OP_RGT] = &&vm_OP_RGT,
-		[OP_RGT_U8] = &&vm_OP_RGT_U8,
-		[OP_RGT_U16] = &&vm_OP_RGT_U16,
-		[OP_LFT] = &&vm_OP_LFT,
-		[OP_LFT_U8] = &&vm_OP_LFT_U8,
-		[OP_LFT_U16] = &&vm_OP_LFT_U16,
-		[OP_INC] = &&vm_OP_INC,
-		[OP_INC_U8] = &&vm_OP_INC_U8,
-		[OP_DEC] = &&vm_OP_DEC,
-		[OP_DEC_U8] = &&vm_OP_DEC_U8,
-		[OP_OUT] = &&vm_OP_OUT,
-		[OP_INP] = &&vm_OP_INP,
-		[OP_BRZ_U8] = &&vm_OP_BRZ_U8,
-		[OP_BRZ_U16] = &&vm_OP_BRZ_U16,
-		[OP_BNZ_U8] = &&vm_OP_BNZ_U8,
-		[OP_BNZ_U16] = &&vm_OP_BNZ_U16,
-		[OP_SET_0] = &&vm_OP_SET_0,
-		[OP_SET_1] = &&vm_OP_SET_1,
-		[OP_SET_U8] = &&vm_OP_SET_U8,
-	};
-#define VM_OP(opcode) vm_##opcode:
-#define VM_DISPATCH() goto *dispatchTable[VM_U8()]
-#define VM_LOOP() VM_DISPATCH();
+#define BRAINIAC_VM_GOTO
+#endif // __GNUC__
+
+// Tail calls are only guaranteed by the musttail attribute. Without it, each
+// dispatch may grow the stack, so the engine is left out.
+#ifdef __has_attribute
+#if __has_attribute(musttail)
+#define BRAINIAC_VM_TAILCALL
+#define VM_MUSTTAIL __attribute__((musttail))
+#endif // __has_attribute(musttail)
+#endif // __has_attribute
+
+#ifdef BRAINIAC_DEBUG
+// Debug counters are local to each thread where supported, so concurrent runs
+// in batches and servers do not share them.
+#ifdef __GNUC__
+#define VM_THREAD_LOCAL __thread
 #else // __GNUC__
-#define VM_LOOP() for (;;) switch (VM_U8())
+#define VM_THREAD_LOCAL
+#endif // __GNUC__
+
+// The number of instructions dispatched since the current thread's bytecode
+// started running. A thread runs one program at a time, so this counts a run.
+static VM_THREAD_LOCAL unsigned long long dispatchCount;
+
+#define VM_COUNT() dispatchCount++
+#else // BRAINIAC_DEBUG
+#define VM_COUNT() (void)0
+#endif // BRAINIAC_DEBUG
+
+// Run after each taken backward branch. Only the metered engine uses this.
+#define VM_BACKEDGE() (void)0
+
+// Get a U16 value from bytecode.
+static uint16_t getU16(const uint8_t *bytecode) {
+	return (uint16_t)((bytecode[1] << 8) | bytecode[0]);
+}
+
+// Get a U32 value from bytecode.
+static uint32_t getU32(const uint8_t *bytecode) {
+	return (uint32_t)getU16(bytecode) | (uint32_t)getU16(bytecode + 2) << 16;
+}
+
+// Bytecode operands. Engines that do not run bytecode directly redefine these.
+#define VM_U8() (*bytecode++)
+#define VM_U16() (bytecode += 2, (uint16_t)((bytecode[-1] << 8) | bytecode[-2]))
+#define VM_S16() ((size_t)(int16_t)VM_U16())
+#define VM_U32() (bytecode += 4, getU32(bytecode - 4))
+#define VM_DATA() (bytecode += 4, bytecode + getU32(bytecode - 4))
+#define VM_JUMP(distance) (bytecode += (distance))
+
+// Wrapping tapes mask the memory pointer after every move, while bounded tapes
+// rely on guard pages instead of bounds checks.
+#define VM_MOVE(distance) (pointer = (pointer + (distance)) & mask)
+#define VM_CELL(offset) memory[(pointer + (offset)) & mask]
+
+// Each opcode's effect, shared by every engine. Superinstructions perform their
+// sequence's effects in order, so effects must read their operands in order.
+#define VM_EXEC_HLT() VM_HALT()
+#define VM_EXEC_RGT() VM_MOVE(1)
+#define VM_EXEC_RGT_U8() VM_MOVE(VM_U8())
+#define VM_EXEC_RGT_U16() VM_MOVE(VM_U16())
+#define VM_EXEC_LFT() VM_MOVE(-1)
+#define VM_EXEC_LFT_U8() VM_MOVE(-(size_t)VM_U8())
+#define VM_EXEC_LFT_U16() VM_MOVE(-(size_t)VM_U16())
+#define VM_EXEC_INC() ++memory[pointer]
+#define VM_EXEC_INC_U8() memory[pointer] += VM_U8()
+#define VM_EXEC_DEC() --memory[pointer]
+#define VM_EXEC_DEC_U8() memory[pointer] -= VM_U8()
+#define VM_EXEC_OUT() outputByte(io, memory[pointer])
+#define VM_EXEC_INP() memory[pointer] = inputByte(io)
+#define VM_EXEC_BRZ_U8() do { \
+	uint8_t offset = VM_U8(); \
+	\
+	if (!memory[pointer]) { \
+		VM_JUMP(offset); \
+	} \
+} while (0)
+#define VM_EXEC_BRZ_U16() do { \
+	uint16_t offset = VM_U16(); \
+	\
+	if (!memory[pointer]) { \
+		VM_JUMP(offset); \
+	} \
+} while (0)
+#define VM_EXEC_BRZ_U32() do { \
+	uint32_t offset = VM_U32(); \
+	\
+	if (!memory[pointer]) { \
+		VM_JUMP(offset); \
+	} \
+} while (0)
+#define VM_EXEC_BNZ_U8() do { \
+	uint8_t offset = VM_U8(); \
+	\
+	if (memory[pointer]) { \
+		VM_JUMP(-offset); \
+		VM_BACKEDGE(); \
+	} \
+} while (0)
+#define VM_EXEC_BNZ_U16() do { \
+	uint16_t offset = VM_U16(); \
+	\
+	if (memory[pointer]) { \
+		VM_JUMP(-offset); \
+		VM_BACKEDGE(); \
+	} \
+} while (0)
+#define VM_EXEC_BNZ_U32() do { \
+	ptrdiff_t offset = (ptrdiff_t)VM_U32(); \
+	\
+	if (memory[pointer]) { \
+		VM_JUMP(-offset); \
+		VM_BACKEDGE(); \
+	} \
+} while (0)
+#define VM_EXEC_SET_0() memory[pointer] = 0
+#define VM_EXEC_SET_1() memory[pointer] = 1
+#define VM_EXEC_SET_U8() memory[pointer] = VM_U8()
+#define VM_EXEC_ADD_OFF() do { \
+	size_t offset = VM_S16(); \
+	VM_CELL(offset) += VM_U8(); \
+} while (0)
+#define VM_EXEC_SET_OFF() do { \
+	size_t offset = VM_S16(); \
+	VM_CELL(offset) = VM_U8(); \
+} while (0)
+#define VM_EXEC_OUT_OFF() outputByte(io, VM_CELL(VM_S16()))
+#define VM_EXEC_INP_OFF() do { \
+	size_t offset = VM_S16(); \
+	VM_CELL(offset) = inputByte(io); \
+} while (0)
+#define VM_EXEC_MUL() do { \
+	size_t offset = VM_S16(); \
+	VM_CELL(offset) += memory[pointer] * VM_U8(); \
+} while (0)
+#define VM_EXEC_COPY() VM_CELL(VM_S16()) += memory[pointer]
+#define VM_EXEC_SCN_RGT() pointer = scanTape(tape, pointer, 1)
+#define VM_EXEC_SCN_RGT_U8() pointer = scanTape(tape, pointer, VM_U8())
+#define VM_EXEC_SCN_LFT() pointer = scanTape(tape, pointer, -1)
+#define VM_EXEC_SCN_LFT_U8() pointer = scanTape(tape, pointer, -VM_U8())
+#define VM_EXEC_CNT_U8() memory[pointer] *= VM_U8()
+#define VM_EXEC_WRITE() do { \
+	const uint8_t *data = VM_DATA(); \
+	outputBytes(io, data, VM_U32()); \
+} while (0)
+
+// Each opcode's handler, shared by every engine. Engines define VM_OP to start
+// a handler, VM_DISPATCH to run the next handler, and VM_HALT to stop.
+#define VM_OPCODE(name) \
+	VM_OP(OP_##name) { \
+		VM_COUNT(); \
+		VM_EXEC_##name(); \
+		VM_DISPATCH(); \
+	}
+#define VM_SUPEROP2(name, first, second) \
+	VM_OP(OP_##name) { \
+		VM_COUNT(); \
+		VM_EXEC_##first(); \
+		VM_EXEC_##second(); \
+		VM_DISPATCH(); \
+	}
+#define VM_SUPEROP3(name, first, second, third) \
+	VM_OP(OP_##name) { \
+		VM_COUNT(); \
+		VM_EXEC_##first(); \
+		VM_EXEC_##second(); \
+		VM_EXEC_##third(); \
+		VM_DISPATCH(); \
+	}
+
+// Store the state of halted bytecode and return. The halting instruction has
+// already been read, so the program counter is moved back to it.
+#define VM_HALT_STATE() do { \
+	state->pc = (size_t)(bytecode - start - 1); \
+	state->pointer = pointer; \
+	return; \
+} while (0)
+
+// Interpret bytecode with a tape and I/O from a state using a switch
+// statement, and store the state when it halts.
+static void interpretSwitch(const uint8_t *start, Tape *tape, IO *io, VMState *state) {
 #define VM_OP(opcode) case opcode:
 #define VM_DISPATCH() break
-#endif // __GNUC__
-	uint16_t pointer = 0;
-	uint8_t memory[UINT16_MAX + 1] = {};
+#define VM_HALT() VM_HALT_STATE()
+	const uint8_t *bytecode = start + state->pc;
+	uint8_t *memory = tape->memory;
+	size_t mask = tape->mask;
+	size_t pointer = state->pointer;
 	
-	VM_LOOP() {
-		VM_OP(OP_HLT) {
-			return;
+	for (;;) {
+		switch (VM_U8()) {
+#define OPCODE(name, operands) VM_OPCODE(name)
+#define SUPEROP2(name, first, second) VM_SUPEROP2(name, first, second)
+#define SUPEROP3(name, first, second, third) VM_SUPEROP3(name, first, second, third)
+#include "opcode.def"
 		}
-		
-		VM_OP(OP_RGT) {
-			++pointer;
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_RGT_U8) {
-			pointer += VM_U8();
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_RGT_U16) {
-			pointer += VM_U16();
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_LFT) {
-			--pointer;
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_LFT_U8) {
-			pointer -= VM_U8();
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_LFT_U16) {
-			pointer -= VM_U16();
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_INC) {
-			++memory[pointer];
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_INC_U8) {
-			memory[pointer] += VM_U8();
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_DEC) {
-			--memory[pointer];
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_DEC_U8) {
-			memory[pointer] -= VM_U8();
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_OUT) {
-			putchar(memory[pointer]);
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_INP) {
-			int value = getchar();
-			memory[pointer] = value != EOF ? (uint8_t)value : 0;
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_BRZ_U8) {
-			uint8_t offset = VM_U8();
-			
-			if (!memory[pointer]) {
-				bytecode += offset;
-			}
-			
-			VM_DISPATCH();
+	}
+#undef VM_HALT
+#undef VM_DISPATCH
+#undef VM_OP
+}
+
+// Widen a pointer range to include a memory cell index and return the index.
+// Indices in the upper half of a wrapping tape are negative offsets.
+static size_t trackCell(PointerRange *range, size_t cell, size_t mask) {
+	ptrdiff_t offset = (ptrdiff_t)(cell > (mask >> 1) ? cell - mask - 1 : cell);
+	range->lowest = offset < range->lowest ? offset : range->lowest;
+	range->highest = offset > range->highest ? offset : range->highest;
+	return cell;
+}
+
+// Interpret bytecode with a tape and I/O using a switch statement, count the
+// instructions dispatched at each address, and fill an optional pointer range.
+// This is a separate copy of the switch engine so that the other engines are
+// not slowed down by profiling.
+static void profileSwitch(const uint8_t *bytecode, Tape *tape, IO *io, uint64_t *counts, PointerRange *range) {
+	// No instruction moves the memory pointer more than once, so the pointer
+	// is tracked before each instruction is dispatched. Memory at an offset
+	// from the pointer is tracked when it is accessed.
+#undef VM_COUNT
+#undef VM_CELL
+#define VM_COUNT() do { \
+	counts[bytecode - start - 1]++; \
+	trackCell(&reached, pointer, mask); \
+} while (0)
+#define VM_CELL(offset) memory[trackCell(&reached, (pointer + (offset)) & mask, mask)]
+#define VM_OP(opcode) case opcode:
+#define VM_DISPATCH() break
+#define VM_HALT() do { \
+	if (range != NULL) { \
+		*range = reached; \
+	} \
+	\
+	return; \
+} while (0)
+	const uint8_t *start = bytecode;
+	uint8_t *memory = tape->memory;
+	size_t mask = tape->mask;
+	size_t pointer = 0;
+	PointerRange reached = {0, 0};
+	
+	for (;;) {
+		switch (VM_U8()) {
+#define OPCODE(name, operands) VM_OPCODE(name)
+#define SUPEROP2(name, first, second) VM_SUPEROP2(name, first, second)
+#define SUPEROP3(name, first, second, third) VM_SUPEROP3(name, first, second, third)
+#include "opcode.def"
 		}
-		
-		VM_OP(OP_BRZ_U16) {
-			uint16_t offset = VM_U16();
-			
-			if (!memory[pointer]) {
-				bytecode += offset;
-			}
-			
-			VM_DISPATCH();
+	}
+#undef VM_HALT
+#undef VM_DISPATCH
+#undef VM_OP
+#undef VM_CELL
+#undef VM_COUNT
+#define VM_CELL(offset) memory[(pointer + (offset)) & mask]
+#ifdef BRAINIAC_DEBUG
+#define VM_COUNT() dispatchCount++
+#else // BRAINIAC_DEBUG
+#define VM_COUNT() (void)0
+#endif // BRAINIAC_DEBUG
+}
+
+#ifdef BRAINIAC_VM_GOTO
+// Interpret bytecode with a tape and I/O from a state using computed goto
+// through a table indexed by opcode, and store the state when it halts.
+static void interpretGoto(const uint8_t *start, Tape *tape, IO *io, VMState *state) {
+#define OPCODE(name, operands) __label__ vm_OP_##name;
+#define SUPEROP2(name, first, second) __label__ vm_OP_##name;
+#define SUPEROP3(name, first, second, third) __label__ vm_OP_##name;
+#include "opcode.def"
+	
+	static void *const dispatchTable[] = {
+#define OPCODE(name, operands) [OP_##name] = &&vm_OP_##name,
+#define SUPEROP2(name, first, second) [OP_##name] = &&vm_OP_##name,
+#define SUPEROP3(name, first, second, third) [OP_##name] = &&vm_OP_##name,
+#include "opcode.def"
+	};
+#define VM_OP(opcode) vm_##opcode:
+#define VM_DISPATCH() goto *dispatchTable[VM_U8()]
+#define VM_HALT() VM_HALT_STATE()
+	const uint8_t *bytecode = start + state->pc;
+	uint8_t *memory = tape->memory;
+	size_t mask = tape->mask;
+	size_t pointer = state->pointer;
+	
+	VM_DISPATCH();
+	
+#define OPCODE(name, operands) VM_OPCODE(name)
+#define SUPEROP2(name, first, second) VM_SUPEROP2(name, first, second)
+#define SUPEROP3(name, first, second, third) VM_SUPEROP3(name, first, second, third)
+#include "opcode.def"
+#undef VM_HALT
+#undef VM_DISPATCH
+#undef VM_OP
+}
+#endif // BRAINIAC_VM_GOTO
+
+// Interpret bytecode with a tape and I/O from a state until it halts or takes a
+// number of backward branches, or until it halts if the number is 0, and store
+// the state. Return whether the bytecode halted. Computed goto through a table
+// indexed by opcode is used if it is supported, or a switch statement
+// otherwise. Only backward branches are metered, so straight-line code runs as
+// fast as in the other engines.
+static bool interpretMetered(const uint8_t *start, Tape *tape, IO *io, VMState *state, uint64_t fuel) {
+	// The fuel is only checked when it reaches 0 after being decremented, so
+	// fuel starting at 0 wraps around and never runs out. Scans of wrapping
+	// tapes with no zero cell never finish, so they stop at the scan instead
+	// of looping forever unless the fuel is unlimited.
+#undef VM_BACKEDGE
+#undef VM_EXEC_SCN_RGT
+#undef VM_EXEC_SCN_RGT_U8
+#undef VM_EXEC_SCN_LFT
+#undef VM_EXEC_SCN_LFT_U8
+#define VM_BACKEDGE() do { \
+	if (--fuel == 0) { \
+		state->pc = (size_t)(bytecode - start); \
+		state->pointer = pointer; \
+		return false; \
+	} \
+} while (0)
+#define VM_SCAN(stride, length) do { \
+	size_t zero = isLimited ? findTapeZero(tape, pointer, (stride)) : scanTape(tape, pointer, (stride)); \
+	\
+	if (zero == tape->size) { \
+		state->pc = (size_t)(bytecode - start - (length)); \
+		state->pointer = pointer; \
+		return false; \
+	} \
+	\
+	pointer = zero; \
+} while (0)
+#define VM_EXEC_SCN_RGT() VM_SCAN(1, 1)
+#define VM_EXEC_SCN_RGT_U8() VM_SCAN(VM_U8(), 2)
+#define VM_EXEC_SCN_LFT() VM_SCAN(-1, 1)
+#define VM_EXEC_SCN_LFT_U8() VM_SCAN(-VM_U8(), 2)
+#define VM_HALT() do { \
+	state->pc = (size_t)(bytecode - start - 1); \
+	state->pointer = pointer; \
+	return true; \
+} while (0)
+#ifdef BRAINIAC_VM_GOTO
+#define OPCODE(name, operands) __label__ vm_OP_##name;
+#define SUPEROP2(name, first, second) __label__ vm_OP_##name;
+#define SUPEROP3(name, first, second, third) __label__ vm_OP_##name;
+#include "opcode.def"
+	
+	static void *const dispatchTable[] = {
+#define OPCODE(name, operands) [OP_##name] = &&vm_OP_##name,
+#define SUPEROP2(name, first, second) [OP_##name] = &&vm_OP_##name,
+#define SUPEROP3(name, first, second, third) [OP_##name] = &&vm_OP_##name,
+#include "opcode.def"
+	};
+#endif // BRAINIAC_VM_GOTO
+	const uint8_t *bytecode = start + state->pc;
+	uint8_t *memory = tape->memory;
+	size_t mask = tape->mask;
+	size_t pointer = state->pointer;
+	bool isLimited = fuel != 0;
+#ifdef BRAINIAC_VM_GOTO
+#define VM_OP(opcode) vm_##opcode:
+#define VM_DISPATCH() goto *dispatchTable[VM_U8()]
+	VM_DISPATCH();
+	
+#define OPCODE(name, operands) VM_OPCODE(name)
+#define SUPEROP2(name, first, second) VM_SUPEROP2(name, first, second)
+#define SUPEROP3(name, first, second, third) VM_SUPEROP3(name, first, second, third)
+#include "opcode.def"
+#else // BRAINIAC_VM_GOTO
+#define VM_OP(opcode) case opcode:
+#define VM_DISPATCH() break
+	for (;;) {
+		switch (VM_U8()) {
+#define OPCODE(name, operands) VM_OPCODE(name)
+#define SUPEROP2(name, first, second) VM_SUPEROP2(name, first, second)
+#define SUPEROP3(name, first, second, third) VM_SUPEROP3(name, first, second, third)
+#include "opcode.def"
 		}
-		
-		VM_OP(OP_BNZ_U8) {
-			uint8_t offset = VM_U8();
-			
-			if (memory[pointer]) {
-				bytecode -= offset;
-			}
-			
-			VM_DISPATCH();
+	}
+#endif // BRAINIAC_VM_GOTO
+#undef VM_HALT
+#undef VM_DISPATCH
+#undef VM_OP
+#undef VM_EXEC_SCN_LFT_U8
+#undef VM_EXEC_SCN_LFT
+#undef VM_EXEC_SCN_RGT_U8
+#undef VM_EXEC_SCN_RGT
+#undef VM_SCAN
+#undef VM_BACKEDGE
+#define VM_EXEC_SCN_RGT() pointer = scanTape(tape, pointer, 1)
+#define VM_EXEC_SCN_RGT_U8() pointer = scanTape(tape, pointer, VM_U8())
+#define VM_EXEC_SCN_LFT() pointer = scanTape(tape, pointer, -1)
+#define VM_EXEC_SCN_LFT_U8() pointer = scanTape(tape, pointer, -VM_U8())
+#define VM_BACKEDGE() (void)0
+}
+
+#ifdef BRAINIAC_VM_TAILCALL
+// Parameters for tail-call handlers. Not every handler uses every parameter.
+#define VM_PARAMS \
+	const uint8_t *bytecode, \
+	__attribute__((unused)) uint8_t *memory, \
+	__attribute__((unused)) size_t pointer, \
+	__attribute__((unused)) size_t mask, \
+	__attribute__((unused)) Tape *tape, \
+	__attribute__((unused)) IO *io
+
+// A tail-call handler for an opcode.
+typedef void TailHandler(VM_PARAMS);
+
+#define OPCODE(name, operands) static TailHandler tail_OP_##name;
+#define SUPEROP2(name, first, second) static TailHandler tail_OP_##name;
+#define SUPEROP3(name, first, second, third) static TailHandler tail_OP_##name;
+#include "opcode.def"
+
+// Tail-call handlers indexed by opcode.
+static TailHandler *const tailHandlers[] = {
+#define OPCODE(name, operands) [OP_##name] = tail_OP_##name,
+#define SUPEROP2(name, first, second) [OP_##name] = tail_OP_##name,
+#define SUPEROP3(name, first, second, third) [OP_##name] = tail_OP_##name,
+#include "opcode.def"
+};
+
+#define VM_OP(opcode) static void tail_##opcode(VM_PARAMS)
+#define VM_DISPATCH() VM_MUSTTAIL return tailHandlers[*bytecode](bytecode + 1, memory, pointer, mask, tape, io)
+#define VM_HALT() return
+#define OPCODE(name, operands) VM_OPCODE(name)
+#define SUPEROP2(name, first, second) VM_SUPEROP2(name, first, second)
+#define SUPEROP3(name, first, second, third) VM_SUPEROP3(name, first, second, third)
+#include "opcode.def"
+#undef VM_HALT
+#undef VM_DISPATCH
+#undef VM_OP
+#undef VM_PARAMS
+
+// Interpret bytecode with a tape and I/O using tail calls through a table
+// indexed by opcode.
+static void interpretTailcall(const uint8_t *bytecode, Tape *tape, IO *io) {
+	tailHandlers[*bytecode](bytecode + 1, tape->memory, 0, tape->mask, tape, io);
+}
+#endif // BRAINIAC_VM_TAILCALL
+
+#ifdef BRAINIAC_VM_GOTO
+// A word of direct-threaded code.
+typedef union {
+	// A handler's address.
+	void *handler;
+	
+	// A widened operand. Offsets are sign-extended and branch operands are
+	// distances in words.
+	size_t operand;
+	
+	// Literal data in bytecode.
+	const uint8_t *data;
+} ThreadWord;
+
+// Get the number of words in direct-threaded code for an instruction.
+static int getThreadedSize(Opcode opcode) {
+	const OpcodeInfo *info = getOpcodeInfo(opcode);
+	int size = 1;
+	
+	for (int i = 0; i < info->length; i++) {
+		switch (getOpcodeInfo(info->sequence[i])->operands) {
+			case OPERANDS_NONE: break;
+			case OPERANDS_S16_U8: size += 2; break;
+			case OPERANDS_DATA: size += 2; break;
+			default: size++; break;
 		}
+	}
+	
+	return size;
+}
+
+// Convert bytecode to direct-threaded code with a handler table.
+static ThreadWord *threadBytecode(const uint8_t *bytecode, void *const *handlers) {
+	int byteCount = 0;
+	int wordCount = 0;
+	Opcode opcode;
+	
+	do {
+		opcode = (Opcode)bytecode[byteCount];
+		byteCount += getInstructionSize(opcode);
+		wordCount += getThreadedSize(opcode);
+	} while (opcode != OP_HLT);
+	
+	ThreadWord *code = (ThreadWord*)malloc(wordCount * sizeof(ThreadWord));
+	int *indices = (int*)malloc((byteCount + 1) * sizeof(int));
+	
+	if (code == NULL || indices == NULL) {
+		exit(EXIT_FAILURE);
+	}
+	
+	for (int address = 0, index = 0; address < byteCount;) {
+		indices[address] = index;
+		index += getThreadedSize((Opcode)bytecode[address]);
+		address += getInstructionSize((Opcode)bytecode[address]);
+	}
+	
+	for (int address = 0, index = 0; address < byteCount;) {
+		opcode = (Opcode)bytecode[address];
+		const OpcodeInfo *info = getOpcodeInfo(opcode);
+		int end = address + getInstructionSize(opcode);
+		int endIndex = index + getThreadedSize(opcode);
+		code[index++].handler = handlers[opcode];
+		address++;
 		
-		VM_OP(OP_BNZ_U16) {
-			uint16_t offset = VM_U16();
+		for (int i = 0; i < info->length; i++) {
+			const uint8_t *operand = &bytecode[address];
 			
-			if (memory[pointer]) {
-				bytecode -= offset;
+			switch (getOpcodeInfo(info->sequence[i])->operands) {
+				case OPERANDS_NONE:
+					break;
+				case OPERANDS_U8:
+					code[index++].operand = operand[0];
+					address++;
+					break;
+				case OPERANDS_U16:
+					code[index++].operand = getU16(operand);
+					address += 2;
+					break;
+				case OPERANDS_S16:
+					code[index++].operand = (size_t)(int16_t)getU16(operand);
+					address += 2;
+					break;
+				case OPERANDS_S16_U8:
+					code[index++].operand = (size_t)(int16_t)getU16(operand);
+					code[index++].operand = operand[2];
+					address += 3;
+					break;
+				case OPERANDS_BRZ_U8:
+					code[index++].operand = indices[end + operand[0]] - endIndex;
+					address++;
+					break;
+				case OPERANDS_BRZ_U16:
+					code[index++].operand = indices[end + getU16(operand)] - endIndex;
+					address += 2;
+					break;
+				case OPERANDS_BRZ_U32:
+					code[index++].operand = indices[end + getU32(operand)] - endIndex;
+					address += 4;
+					break;
+				case OPERANDS_BNZ_U8:
+					code[index++].operand = endIndex - indices[end - operand[0]];
+					address++;
+					break;
+				case OPERANDS_BNZ_U16:
+					code[index++].operand = endIndex - indices[end - getU16(operand)];
+					address += 2;
+					break;
+				case OPERANDS_BNZ_U32:
+					code[index++].operand = endIndex - indices[end - getU32(operand)];
+					address += 4;
+					break;
+				case OPERANDS_DATA:
+					code[index++].data = operand + 4 + getU32(operand);
+					code[index++].operand = getU32(operand + 4);
+					address += 8;
+					break;
 			}
-			
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_SET_0) {
-			memory[pointer] = 0;
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_SET_1) {
-			memory[pointer] = 1;
-			VM_DISPATCH();
-		}
-		
-		VM_OP(OP_SET_U8) {
-			memory[pointer] = VM_U8();
-			VM_DISPATCH();
 		}
 	}
-#undef VM_LOOP
+	
+	free(indices);
+	return code;
+}
+
+// Direct-threaded code has widened operands.
+#undef VM_JUMP
+#undef VM_DATA
+#undef VM_U32
+#undef VM_S16
+#undef VM_U16
+#undef VM_U8
+#define VM_U8() ((bytecode++)->operand)
+#define VM_U16() ((bytecode++)->operand)
+#define VM_S16() ((bytecode++)->operand)
+#define VM_U32() ((bytecode++)->operand)
+#define VM_DATA() ((bytecode++)->data)
+#define VM_JUMP(distance) (bytecode += (distance))
+
+// Run direct-threaded code with a tape and I/O, or get the handler table if the
+// code is NULL.
+static void *const *runThreadedCode(const ThreadWord *bytecode, Tape *tape, IO *io) {
+#define OPCODE(name, operands) __label__ vm_OP_##name;
+#define SUPEROP2(name, first, second) __label__ vm_OP_##name;
+#define SUPEROP3(name, first, second, third) __label__ vm_OP_##name;
+#include "opcode.def"
+	
+	static void *const dispatchTable[] = {
+#define OPCODE(name, operands) [OP_##name] = &&vm_OP_##name,
+#define SUPEROP2(name, first, second) [OP_##name] = &&vm_OP_##name,
+#define SUPEROP3(name, first, second, third) [OP_##name] = &&vm_OP_##name,
+#include "opcode.def"
+	};
+	
+	if (bytecode == NULL) {
+		return dispatchTable;
+	}
+#define VM_OP(opcode) vm_##opcode:
+#define VM_DISPATCH() goto *(bytecode++)->handler
+#define VM_HALT() return NULL
+	uint8_t *memory = tape->memory;
+	size_t mask = tape->mask;
+	size_t pointer = 0;
+	
+	VM_DISPATCH();
+	
+#define OPCODE(name, operands) VM_OPCODE(name)
+#define SUPEROP2(name, first, second) VM_SUPEROP2(name, first, second)
+#define SUPEROP3(name, first, second, third) VM_SUPEROP3(name, first, second, third)
+#include "opcode.def"
+#undef VM_HALT
 #undef VM_DISPATCH
 #undef VM_OP
+}
+
+// Interpret bytecode with a tape and I/O using computed goto through
+// pre-decoded handler addresses.
+static void interpretThreaded(const uint8_t *bytecode, Tape *tape, IO *io) {
+	ThreadWord *code = threadBytecode(bytecode, runThreadedCode(NULL, tape, io));
+	runThreadedCode(code, tape, io);
+	free(code);
+}
+#endif // BRAINIAC_VM_GOTO
+
+#undef VM_HALT_STATE
+#undef VM_SUPEROP3
+#undef VM_SUPEROP2
+#undef VM_OPCODE
+#undef VM_EXEC_WRITE
+#undef VM_EXEC_CNT_U8
+#undef VM_EXEC_SCN_LFT_U8
+#undef VM_EXEC_SCN_LFT
+#undef VM_EXEC_SCN_RGT_U8
+#undef VM_EXEC_SCN_RGT
+#undef VM_EXEC_COPY
+#undef VM_EXEC_MUL
+#undef VM_EXEC_INP_OFF
+#undef VM_EXEC_OUT_OFF
+#undef VM_EXEC_SET_OFF
+#undef VM_EXEC_ADD_OFF
+#undef VM_EXEC_SET_U8
+#undef VM_EXEC_SET_1
+#undef VM_EXEC_SET_0
+#undef VM_EXEC_BNZ_U32
+#undef VM_EXEC_BNZ_U16
+#undef VM_EXEC_BNZ_U8
+#undef VM_EXEC_BRZ_U32
+#undef VM_EXEC_BRZ_U16
+#undef VM_EXEC_BRZ_U8
+#undef VM_EXEC_INP
+#undef VM_EXEC_OUT
+#undef VM_EXEC_DEC_U8
+#undef VM_EXEC_DEC
+#undef VM_EXEC_INC_U8
+#undef VM_EXEC_INC
+#undef VM_EXEC_LFT_U16
+#undef VM_EXEC_LFT_U8
+#undef VM_EXEC_LFT
+#undef VM_EXEC_RGT_U16
+#undef VM_EXEC_RGT_U8
+#undef VM_EXEC_RGT
+#undef VM_EXEC_HLT
+#undef VM_CELL
+#undef VM_MOVE
+#undef VM_JUMP
+#undef VM_DATA
+#undef VM_U32
+#undef VM_S16
 #undef VM_U16
 #undef VM_U8
+#undef VM_BACKEDGE
+#undef VM_COUNT
+
+// Return whether an engine is supported.
+bool isEngineSupported(Engine engine) {
+	switch (engine) {
+		case ENGINE_SWITCH:
+			return true;
+		case ENGINE_GOTO:
+		case ENGINE_THREADED:
+#ifdef BRAINIAC_VM_GOTO
+			return true;
+#else // BRAINIAC_VM_GOTO
+			return false;
+#endif // BRAINIAC_VM_GOTO
+		case ENGINE_TAILCALL:
+#ifdef BRAINIAC_VM_TAILCALL
+			return true;
+#else // BRAINIAC_VM_TAILCALL
+			return false;
+#endif // BRAINIAC_VM_TAILCALL
+	}
+	
+	return false;
+}
+
+// Get the default engine.
+Engine getDefaultEngine() {
+	return isEngineSupported(ENGINE_GOTO) ? ENGINE_GOTO : ENGINE_SWITCH;
+}
+
+// Interpret bytecode with a tape, I/O, and an engine.
+void interpretBytecode(uint8_t *bytecode, Tape *tape, IO *io, Engine engine) {
+	if (!isEngineSupported(engine)) {
+		engine = getDefaultEngine();
+	}
+	
+#ifdef BRAINIAC_DEBUG
+	dispatchCount = 0;
+#endif // BRAINIAC_DEBUG
+	VMState state = {0, 0};
+	
+	switch (engine) {
+		case ENGINE_SWITCH: interpretSwitch(bytecode, tape, io, &state); break;
+#ifdef BRAINIAC_VM_GOTO
+		case ENGINE_GOTO: interpretGoto(bytecode, tape, io, &state); break;
+		case ENGINE_THREADED: interpretThreaded(bytecode, tape, io); break;
+#endif // BRAINIAC_VM_GOTO
+#ifdef BRAINIAC_VM_TAILCALL
+		case ENGINE_TAILCALL: interpretTailcall(bytecode, tape, io); break;
+#endif // BRAINIAC_VM_TAILCALL
+		default: break;
+	}
+	
+	flushOutput(io);
+	
+#ifdef BRAINIAC_DEBUG
+	printf("Dispatched %llu instructions.\n", dispatchCount);
+#endif // BRAINIAC_DEBUG
+}
+
+// Interpret bytecode with a tape and I/O from a state and store the state when
+// the bytecode halts.
+void resumeBytecode(const uint8_t *bytecode, Tape *tape, IO *io, VMState *state) {
+#ifdef BRAINIAC_VM_GOTO
+	interpretGoto(bytecode, tape, io, state);
+#else // BRAINIAC_VM_GOTO
+	interpretSwitch(bytecode, tape, io, state);
+#endif // BRAINIAC_VM_GOTO
+	flushOutput(io);
+}
+
+// Interpret bytecode with a tape and I/O from a state until it halts or takes a
+// number of backward branches, store the state, and flush the output. Return
+// whether the bytecode halted.
+bool meterBytecode(const uint8_t *bytecode, Tape *tape, IO *io, VMState *state, uint64_t fuel) {
+	bool isHalted = interpretMetered(bytecode, tape, io, state, fuel);
+	flushOutput(io);
+	return isHalted;
+}
+
+// Interpret bytecode with a tape and I/O, count the instructions dispatched at
+// each address of the bytecode, and fill an optional pointer range.
+void profileBytecode(uint8_t *bytecode, Tape *tape, IO *io, uint64_t *counts, PointerRange *range) {
+	profileSwitch(bytecode, tape, io, counts, range);
+	flushOutput(io);
 }
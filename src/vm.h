@@ -1,9 +1,65 @@
 #ifndef BRAINIAC_VM_H
 #define BRAINIAC_VM_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
-// Interpret bytecode.
-void interpretBytecode(uint8_t *bytecode);
+#include "io.h"
+#include "tape.h"
+
+// A bytecode dispatch engine.
+typedef enum {
+	ENGINE_SWITCH, // Switch statement.
+	ENGINE_GOTO, // Computed goto through a table indexed by opcode.
+	ENGINE_THREADED, // Computed goto through pre-decoded handler addresses.
+	ENGINE_TAILCALL, // Tail calls through a table indexed by opcode.
+} Engine;
+
+// The range of memory accessed through the memory pointer and its offsets by
+// bytecode, relative to the first cell of the tape.
+typedef struct {
+	// The lowest memory offset.
+	ptrdiff_t lowest;
+	
+	// The highest memory offset.
+	ptrdiff_t highest;
+} PointerRange;
+
+// The state of bytecode being interpreted.
+typedef struct {
+	// The address of the next instruction.
+	size_t pc;
+	
+	// The memory pointer's index on the tape.
+	size_t pointer;
+} VMState;
+
+// Return whether an engine is supported.
+bool isEngineSupported(Engine engine);
+
+// Get the default engine.
+Engine getDefaultEngine();
+
+// Interpret bytecode with a tape, I/O, and an engine. Bytecode can be
+// interpreted by multiple threads at once with separate tapes and I/O.
+void interpretBytecode(uint8_t *bytecode, Tape *tape, IO *io, Engine engine);
+
+// Interpret bytecode with a tape and I/O from a state and store the state when
+// the bytecode halts. Bytecode is resumed with the goto engine if it is
+// supported, or the switch engine otherwise.
+void resumeBytecode(const uint8_t *bytecode, Tape *tape, IO *io, VMState *state);
+
+// Interpret bytecode with a tape and I/O from a state until it halts or takes a
+// number of backward branches, or until it halts if the number is 0, store the
+// state, and flush the output. Return whether the bytecode halted. Bytecode
+// that did not halt can be resumed from its state with more branches. Unless the
+// number is 0, scans of wrapping tapes that have no zero cell also stop without
+// halting.
+bool meterBytecode(const uint8_t *bytecode, Tape *tape, IO *io, VMState *state, uint64_t fuel);
+
+// Interpret bytecode with a tape and I/O, count the instructions dispatched at
+// each address of the bytecode, and fill an optional pointer range.
+void profileBytecode(uint8_t *bytecode, Tape *tape, IO *io, uint64_t *counts, PointerRange *range);
 
 #endif // BRAINIAC_VM_H